@@ -10,12 +10,70 @@
 #include <JLib/UART0.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
 #include "JLib/tm4c123gh6pm.h"
+#include "telemetry.h"
+#include "fmt.h"
 
 // PortA masks
 #define UART_TX_MASK 2 // PA1
 #define UART_RX_MASK 1 // PA0
 
+#define TX_MASK (UART0_TX_SIZE - 1)
+#define RX_MASK (UART0_RX_SIZE - 1)
+
+// uDMA channel 9, encoding 0 is UART0 TX
+#define TX_DMA_CH   9
+#define TX_DMA_BIT  (1 << TX_DMA_CH)
+
+// Frame states
+#define FRAME_FREE    0
+#define FRAME_QUEUED  1
+#define FRAME_SENDING 2
+
+// sendUart0Telemetry closes telemetry frames straight into a uDMA frame
+#if TELEMETRY_ENCODED_MAX > UART0_FRAME_SIZE
+#error "A telemetry frame does not fit a uDMA frame"
+#endif
+
+//-----------------------------------------------------------------------------
+// Global variables
+//-----------------------------------------------------------------------------
+
+// TX ring buffer
+// Only the writer moves txHead and only the UART0 ISR moves txTail, so the
+// two sides need no lock
+char txBuffer[UART0_TX_SIZE];
+volatile uint16_t txHead = 0;
+volatile uint16_t txTail = 0;
+uint16_t stageHead;                                     // end of the characters being pushed
+UART0_POLICY txPolicy = UART0_BLOCK;
+UART0_STATS uart0Stats;
+
+// uDMA channel control table, primary structures of channels 0-31
+// 4 words per channel: source end, destination end, control, unused
+// volatile so the compiler cannot move a descriptor write past the
+// UDMAENASET write that starts the channel
+#pragma DATA_ALIGN(dmaTable, 1024)
+volatile uint32_t dmaTable[32 * 4];
+
+// Double-buffered TX frames, the application fills one while the other is sent
+char txFrame[2][UART0_FRAME_SIZE];
+uint16_t txFrameSize[2];
+volatile uint8_t frameState[2] = { FRAME_FREE, FRAME_FREE };
+uint8_t fillFrame = 0;                                  // next frame handed to the application
+uint8_t sendFrame = 0;                                  // next frame sent by the uDMA
+volatile bool dmaBusy = false;
+bool dmaEnabled = false;
+
+// RX ring buffer, filled by the UART0 ISR
+char rxBuffer[UART0_RX_SIZE];
+volatile uint16_t rxHead = 0;
+volatile uint16_t rxTail = 0;
+
+// Characters of the line being assembled
+uint8_t lineCount = 0;
+
 //-----------------------------------------------------------------------------
 // Subroutines
 //-----------------------------------------------------------------------------
@@ -37,232 +95,557 @@ void initUart0()
                                                         // select UART0 to drive pins PA0 and PA1: default, added for clarity
 
     // Configure UART0 to 115200 baud, 8N1 format
+    // The divisors come from the same calculation as setUart0BaudRate
+    txHead = txTail = 0;
     UART0_CTL_R = 0;                                    // turn-off UART0 to allow safe programming
     UART0_CC_R = UART_CC_CS_SYSCLK;                     // use system clock (40 MHz)
-    UART0_IBRD_R = 21;                                  // r = 40 MHz / (Nx115.2kHz), set floor(r)=21, where N=16
-    UART0_FBRD_R = 45;                                  // round(fract(r)*64)=45
-    UART0_LCRH_R = UART_LCRH_WLEN_8 | UART_LCRH_FEN;    // configure for 8N1 w/ 16-level FIFO
-    UART0_CTL_R = UART_CTL_TXE | UART_CTL_RXE | UART_CTL_UARTEN;
-                                                        // enable TX, RX, and module
+    setUart0BaudRate(115200, 40000000, 0);
+
+    // TX interrupt is enabled by the ISR itself while the ring has data
+    // RX and receive time-out interrupts fill the RX ring
+    rxHead = rxTail = 0;
+    lineCount = 0;
+    UART0_IM_R = UART_IM_RXIM | UART_IM_RTIM;
+    NVIC_EN0_R |= 1 << (INT_UART0 - 16);
+}
+
+// Divisors for a baud rate, no register access
+// r = fcyc / (N x baudRate) with N = 16, or N = 8 in high-speed mode, which is
+// only used above fcyc / 16; IBRD = floor(r), FBRD = round(fract(r) x 64)
+// Returns false if the rate is above fcyc / 8 or off by more than
+// UART0_BAUD_TOLERANCE, baud still gets the closest setting
+bool computeUart0Baud(uint32_t baudRate, uint32_t fcyc, UART0_BAUD *baud)
+{
+    uint32_t divisorTimes128, divisorTimes64;
+    uint8_t n;
+
+    baud->baudRate = 0;
+    baud->error = 0;
+    if (baudRate == 0 || baudRate > fcyc / 8)
+        return false;
+    baud->highSpeed = baudRate > fcyc / 16;
+    n = baud->highSpeed ? 8 : 16;
+    divisorTimes128 = (fcyc * (128 / n)) / baudRate;    // calculate divisor (r) in units of 1/128
+    divisorTimes64 = (divisorTimes128 + 1) >> 1;        // add 1/128 to allow rounding
+    if (divisorTimes64 >> 6 > 0xFFFF)
+        return false;
+    baud->ibrd = divisorTimes64 >> 6;
+    baud->fbrd = divisorTimes64 & 63;
+    baud->baudRate = (fcyc * (64 / n) + divisorTimes64 / 2) / divisorTimes64;
+    baud->error = ((int64_t)baud->baudRate - baudRate) * 10000 / baudRate;
+    return baud->error <= UART0_BAUD_TOLERANCE && baud->error >= -UART0_BAUD_TOLERANCE;
 }
 
 // Set baud rate as function of instruction cycle frequency
-void setUart0BaudRate(uint32_t baudRate, uint32_t fcyc)
+// Waits for queued data to go out at the old rate, then reprograms UART0
+// Returns false and leaves the rate unchanged if it is out of tolerance,
+// baud (optional) gets the actual rate and error
+bool setUart0BaudRate(uint32_t baudRate, uint32_t fcyc, UART0_BAUD *baud)
 {
-    uint32_t divisorTimes128 = (fcyc * 8) / baudRate;   // calculate divisor (r) in units of 1/128,
-                                                        // where r = fcyc / 16 * baudRate
-    divisorTimes128 += 1;                               // add 1/128 to allow rounding
+    UART0_BAUD setting;
+
+    if (baud == 0)
+        baud = &setting;
+    if (!computeUart0Baud(baudRate, fcyc, baud))
+        return false;
+    while (txHead != txTail || frameState[0] != FRAME_FREE || frameState[1] != FRAME_FREE);
+    while (UART0_FR_R & UART_FR_BUSY);
     UART0_CTL_R = 0;                                    // turn-off UART0 to allow safe programming
-    UART0_IBRD_R = divisorTimes128 >> 7;                // set integer value to floor(r)
-    UART0_FBRD_R = ((divisorTimes128) >> 1) & 63;       // set fractional value to round(fract(r)*64)
-    UART0_LCRH_R = UART_LCRH_WLEN_8 | UART_LCRH_FEN;    // configure for 8N1 w/ 16-level FIFO
-    UART0_CTL_R = UART_CTL_TXE | UART_CTL_RXE | UART_CTL_UARTEN;
+    UART0_IBRD_R = baud->ibrd;
+    UART0_FBRD_R = baud->fbrd;
+    UART0_LCRH_R = UART_LCRH_WLEN_8 | UART_LCRH_FEN;    // configure for 8N1 w/ 16-level FIFO, latches the divisors
+    UART0_CTL_R = UART_CTL_TXE | UART_CTL_RXE | UART_CTL_UARTEN | (baud->highSpeed ? UART_CTL_HSE : 0);
                                                         // turn-on UART0
+    return true;
 }
 
 void setupUart0()
 {
     initUart0();
-    setUart0BaudRate(115200, 40e6);
 }
 
-// Blocking function that writes a serial character when the UART buffer is not full
+// Queue bytes for transmission, returns the number accepted
+// UART0_BLOCK waits for space, UART0_DROP discards what does not fit
+uint16_t uart0_write(const char *data, uint16_t size)
+{
+    uint16_t head = txHead;
+    uint16_t i;
+
+    for (i = 0; i < size; i++)
+    {
+        if (((head + 1) & TX_MASK) == txTail)
+        {
+            if (txPolicy == UART0_DROP)
+            {
+                uart0Stats.txDropped += size - i;
+                break;
+            }
+            // publish what is queued so the ISR can make room
+            txHead = head;
+            NVIC_PEND0_R = 1 << (INT_UART0 - 16);
+            while (((head + 1) & TX_MASK) == txTail);
+        }
+        txBuffer[head] = data[i];
+        head = (head + 1) & TX_MASK;
+    }
+    stageHead = head;
+    commitUart0Tx();
+    return i;
+}
+
+// Make room for size bytes (less than UART0_TX_SIZE) that are then stored
+// one at a time with pushUart0Tx and published together by commitUart0Tx,
+// so formatters need no intermediate string
+// Returns false, with nothing to push, if the policy drops and they do not fit
+bool reserveUart0Tx(uint16_t size)
+{
+    if (((txTail - txHead - 1) & TX_MASK) < size)
+    {
+        if (txPolicy == UART0_DROP)
+        {
+            uart0Stats.txDropped += size;
+            return false;
+        }
+        NVIC_PEND0_R = 1 << (INT_UART0 - 16);
+        while (((txTail - txHead - 1) & TX_MASK) < size);
+    }
+    stageHead = txHead;
+    return true;
+}
+
+void pushUart0Tx(char c)
+{
+    txBuffer[stageHead] = c;
+    stageHead = (stageHead + 1) & TX_MASK;
+}
+
+void commitUart0Tx(void)
+{
+    uint16_t used;
+
+    txHead = stageHead;
+    used = (stageHead - txTail) & TX_MASK;
+    if (used > uart0Stats.txHighWater)
+        uart0Stats.txHighWater = used;
+
+    // the ISR refills the FIFO, pending it starts transmission if idle
+    NVIC_PEND0_R = 1 << (INT_UART0 - 16);
+}
+
+void setUart0TxPolicy(UART0_POLICY policy)
+{
+    txPolicy = policy;
+}
+
+// Bytes still waiting in the ring
+uint16_t getUart0TxCount(void)
+{
+    return (txHead - txTail) & TX_MASK;
+}
+
+void getUart0Stats(UART0_STATS *stats)
+{
+    *stats = uart0Stats;
+}
+
+void resetUart0Stats(void)
+{
+    uart0Stats.txHighWater = getUart0TxCount();
+    uart0Stats.txDropped = 0;
+    uart0Stats.rxDropped = 0;
+}
+
+// Send whole frames through uDMA channel 9
+// The CPU only touches a frame when it starts and when it completes
+void enableUart0Dma(void)
+{
+    SYSCTL_RCGCDMA_R |= SYSCTL_RCGCDMA_R0;
+    _delay_cycles(3);
+    UDMA_CFG_R = UDMA_CFG_MASTEN;
+    UDMA_CTLBASE_R = (uint32_t)dmaTable;
+    UDMA_CHMAP1_R &= ~UDMA_CHMAP1_CH9SEL_M;            // UART0 TX
+    UDMA_PRIOCLR_R = TX_DMA_BIT;
+    UDMA_ALTCLR_R = TX_DMA_BIT;
+    UDMA_USEBURSTCLR_R = TX_DMA_BIT;
+    UDMA_REQMASKCLR_R = TX_DMA_BIT;
+    UART0_DMACTL_R |= UART_DMACTL_TXDMAE;
+    dmaEnabled = true;
+}
+
+// Frame for the application to fill, or 0 while both are queued or in flight
+char *getUart0Frame(void)
+{
+    if (frameState[fillFrame] != FRAME_FREE)
+        return 0;
+    return txFrame[fillFrame];
+}
+
+// Queue the frame from getUart0Frame with size bytes
+bool sendUart0Frame(uint16_t size)
+{
+    if (size == 0 || size > UART0_FRAME_SIZE || frameState[fillFrame] != FRAME_FREE)
+        return false;
+    txFrameSize[fillFrame] = size;
+    frameState[fillFrame] = FRAME_QUEUED;
+    fillFrame ^= 1;
+    NVIC_PEND0_R = 1 << (INT_UART0 - 16);
+    return true;
+}
+
+// Close the telemetry frame straight into a uDMA frame, or into the TX ring
+// when uDMA is not enabled; the encoder is empty afterwards either way
+// Returns false if the frame was dropped because both uDMA frames are busy
+bool sendUart0Telemetry(TELEMETRY_ENCODER *e)
+{
+    uint8_t encoded[TELEMETRY_ENCODED_MAX];
+    uint16_t size;
+    char *out;
+
+    if (!dmaEnabled)
+    {
+        size = finishTelemetry(e, encoded);
+        return uart0_write((char*)encoded, size) == size;
+    }
+    out = getUart0Frame();
+    if (out == 0)
+    {
+        uart0Stats.txDropped++;
+        e->size = 0;
+        return false;
+    }
+    return sendUart0Frame(finishTelemetry(e, (uint8_t*)out));
+}
+
+// Basic memory to peripheral transfer, byte wide, destination fixed at UARTDR
+// ARBSIZE 4 matches the UART burst request at the half-empty FIFO level
+static void startUart0Dma(uint8_t frame)
+{
+    uint16_t size = txFrameSize[frame];
+    dmaTable[TX_DMA_CH * 4 + 0] = (uint32_t)&txFrame[frame][size - 1];
+    dmaTable[TX_DMA_CH * 4 + 1] = (uint32_t)&UART0_DR_R;
+    dmaTable[TX_DMA_CH * 4 + 2] = UDMA_CHCTL_DSTINC_NONE | UDMA_CHCTL_DSTSIZE_8 | UDMA_CHCTL_SRCINC_8
+                                | UDMA_CHCTL_SRCSIZE_8 | UDMA_CHCTL_ARBSIZE_4
+                                | ((size - 1) << UDMA_CHCTL_XFERSIZE_S) | UDMA_CHCTL_XFERMODE_BASIC;
+    frameState[frame] = FRAME_SENDING;
+    dmaBusy = true;
+    UDMA_ENASET_R = TX_DMA_BIT;
+}
+
+// UART0 interrupt, also the uDMA completion interrupt of the TX channel
+// Frames and ring data share the FIFO, so the ring is only drained between
+// frames; the TX interrupt stays enabled only while ring data remains, to be
+// called back when the FIFO drains below its trigger level
+void uart0Isr(void)
+{
+    uint16_t tail = txTail;
+    uint16_t head = rxHead;
+
+    // receive, a full ring drops the newest characters
+    while (!(UART0_FR_R & UART_FR_RXFE))
+    {
+        if (((head + 1) & RX_MASK) != rxTail)
+        {
+            rxBuffer[head] = UART0_DR_R & 0xFF;
+            head = (head + 1) & RX_MASK;
+        }
+        else
+        {
+            UART0_DR_R;
+            uart0Stats.rxDropped++;
+        }
+    }
+    rxHead = head;
+    UART0_ICR_R = UART_ICR_RXIC | UART_ICR_RTIC;
+
+    if (UDMA_CHIS_R & TX_DMA_BIT)
+    {
+        UDMA_CHIS_R = TX_DMA_BIT;
+        frameState[sendFrame] = FRAME_FREE;
+        sendFrame ^= 1;
+        dmaBusy = false;
+    }
+    if (!dmaBusy && frameState[sendFrame] == FRAME_QUEUED)
+        startUart0Dma(sendFrame);
+
+    while (!dmaBusy && tail != txHead && !(UART0_FR_R & UART_FR_TXFF))
+    {
+        UART0_DR_R = txBuffer[tail];
+        tail = (tail + 1) & TX_MASK;
+    }
+    txTail = tail;
+    UART0_ICR_R = UART_ICR_TXIC;
+    if (!dmaBusy && tail != txHead)
+        UART0_IM_R |= UART_IM_TXIM;
+    else
+        UART0_IM_R &= ~UART_IM_TXIM;
+}
+
+// Writes a serial character through the TX ring
 void putcUart0(char c)
 {
-    while (UART0_FR_R & UART_FR_TXFF);               // wait if uart0 tx fifo full
-    UART0_DR_R = c;                                  // write character to fifo
+    uart0_write(&c, 1);
 }
 
-// Blocking function that writes a string when the UART buffer is not full
+// Writes a string through the TX ring
 void putsUart0(char* str)
 {
-    uint8_t i = 0;
+    uint16_t i = 0;
     while (str[i] != '\0')
-        putcUart0(str[i++]);
+        i++;
+    uart0_write(str, i);
 }
 
-// Blocking function that returns with serial data once the buffer is not empty
+// Blocking function that returns with serial data once the RX ring is not empty
 char getcUart0()
 {
-    while (UART0_FR_R & UART_FR_RXFE);               // wait if uart0 rx fifo empty
-    return UART0_DR_R & 0xFF;                        // get character from fifo
+    char c;
+    while (rxTail == rxHead);                           // wait if rx ring empty
+    c = rxBuffer[rxTail];
+    rxTail = (rxTail + 1) & RX_MASK;
+    return c;
 }
 
-// Returns the status of the receive buffer
+// Returns the status of the receive ring
 bool kbhitUart0()
 {
-    return !(UART0_FR_R & UART_FR_RXFE);
+    return rxTail != rxHead;
 }
 
-/*
-// receive string input from UART
-int32_t getsUart0(USER_DATA *data)
+// Non-blocking line assembler, consumes whatever has been received
+// Returns true once a line ends with a carriage return or reaches MAX_CHARS,
+// the line is then null terminated in data->buffer
+bool getsUart0(USER_DATA *data)
 {
-    char count = 0;
-    while(1)
+    char c;
+    while (kbhitUart0())
     {
-        char input = getcUart0();
+        c = getcUart0();
 
         //if backspace then have the last character overwritten
-        if ((input == 8 || input == 127) && count > 0)
-        {
-            count--;
-        }
+        if ((c == 8 || c == 127) && lineCount > 0)
+            lineCount--;
 
         //if carriage return then add null terminator to end of string
-        else if (input == 13)
+        else if (c == 13)
         {
-            data->buffer[count] = '\0';
-            return 0;
+            data->buffer[lineCount] = '\0';
+            lineCount = 0;
+            return true;
         }
-        else if (input >= 32)
+        else if (c >= 32 && c < 127)
         {
-            data->buffer[count] = input;
-            count++;
-
-            if (count == MAX_CHARS - 1)
+            data->buffer[lineCount++] = c;
+            if (lineCount == MAX_CHARS)
             {
-                data->buffer[count] = '\0';
-                return 0;
+                data->buffer[lineCount] = '\0';
+                lineCount = 0;
+                return true;
             }
         }
     }
+    return false;
 }
-*/
 
-// parse the data into fields to make it easier to read from
-void parseFields(USER_DATA *data)
+static bool isDelimiter(char c)
 {
+    return c == ' ' || c == '\t' || c == ',';
+}
 
-    char lastField = 'd';
-    uint8_t i = 0;
-    data->fieldCount = 0;
-
-    for (i = 0; data->buffer[i] != '\0' && i < MAX_CHARS && data->fieldCount < MAX_FIELDS; i++)
+// Signed decimal, or hex with a 0x prefix, of exactly length characters
+static bool toInteger(const char *str, uint8_t length, int32_t *value)
+{
+    const char *end = str + length;
+    bool negative = false;
+    uint32_t sum = 0;
+    uint32_t limit;
+    uint8_t digit;
+
+    if (str < end && (*str == '-' || *str == '+'))
+        negative = *str++ == '-';
+    if (end - str > 2 && str[0] == '0' && (str[1] == 'x' || str[1] == 'X'))
     {
-        //if alpha
-        if ((data->buffer[i] >= 'a' && data->buffer[i] <= 'z') || (data->buffer[i] >= 'A' && data->buffer[i] <= 'Z'))
+        for (str += 2; str < end; str++)
         {
-            if (lastField == 'd')
-            {
-                data->fieldPosition[data->fieldCount] = i;
-                data->fieldType[data->fieldCount] = 'a';
-                data->fieldCount++;
-                lastField = 'a';
-            }
-        }
-        //if numeric
-        else if (data->buffer[i] >= '0' && data->buffer[i] <= '9')
-        {
-            if (lastField == 'd')
-            {
-                data->fieldPosition[data->fieldCount] = i;
-                data->fieldType[data->fieldCount] = 'n';
-                data->fieldCount++;
-                lastField = 'n';
-            }
-
+            if (*str >= '0' && *str <= '9')
+                digit = *str - '0';
+            else if ((*str | 0x20) >= 'a' && (*str | 0x20) <= 'f')
+                digit = (*str | 0x20) - 'a' + 10;
+            else
+                return false;
+            if (sum >> 28)
+                return false;
+            sum = (sum << 4) | digit;
         }
-        //if delimiter
-        else
+    }
+    else
+    {
+        if (str == end)
+            return false;
+        limit = negative ? 0x80000000 : 0x7FFFFFFF;
+        for (; str < end; str++)
         {
-            data->buffer[i] = '\0';
-            lastField = 'd';
+            if (*str < '0' || *str > '9' || sum > (limit - (*str - '0')) / 10)
+                return false;
+            sum = sum * 10 + *str - '0';
         }
     }
+    *value = negative ? (int32_t)(0u - sum) : (int32_t)sum;
+    return true;
 }
 
-// receive integer input from a field
-int32_t getFieldInteger(USER_DATA* data, uint8_t fieldNumber)
+// Signed decimal with an optional fraction, e.g. -1.25 or .5
+static bool toFloat(const char *str, uint8_t length, float *value)
 {
-    uint8_t index;
-    int32_t sum = 0;
-
-    for (index = data->fieldPosition[fieldNumber]; data->buffer[index] != '\0'; index++)
-    {
-        sum = (sum*10) + data->buffer[index] - '0';
-    }
-
-    return sum;
+    const char *end = str + length;
+    bool negative = false;
+    bool digits = false;
+    float sum = 0;
+    float scale = 1;
+
+    if (str < end && (*str == '-' || *str == '+'))
+        negative = *str++ == '-';
+    for (; str < end && *str >= '0' && *str <= '9'; str++, digits = true)
+        sum = sum * 10 + (*str - '0');
+    if (str < end && *str == '.')
+        for (str++; str < end && *str >= '0' && *str <= '9'; str++, digits = true)
+            sum += (*str - '0') * (scale *= 0.1f);
+    if (str != end || !digits)
+        return false;
+    *value = negative ? -sum : sum;
+    return true;
 }
 
-// receive float input from a field
-float getFieldFloat(USER_DATA* data, uint8_t fieldNumber)
+// Split the buffer into fields in place, nothing is copied
+// A field is a run of characters up to a space, tab or comma, which are
+// overwritten with '\0' so each field is also a terminated string
+// fieldType is 'n' for an integer that fits int32_t or a number with a
+// fraction, otherwise 'a', so out of range integers are not numbers
+void parseFields(USER_DATA *data)
 {
-    uint8_t index;
-    float sum = 0;
+    char *buffer = data->buffer;
+    uint8_t i = 0;
+    uint8_t start, length;
+    int32_t integer;
+    float real;
+    bool fraction;
 
-    for (index = data->fieldPosition[fieldNumber]; data->buffer[index] != '\0'; index++)
+    data->fieldCount = 0;
+    while (data->fieldCount < MAX_FIELDS)
     {
-        sum = (sum*10) + data->buffer[index] - '0';
+        while (isDelimiter(buffer[i]))
+            i++;
+        if (buffer[i] == '\0')
+            break;
+        start = i;
+        while (buffer[i] != '\0' && !isDelimiter(buffer[i]))
+            i++;
+        length = i - start;
+        data->fieldPosition[data->fieldCount] = start;
+        data->fieldLength[data->fieldCount] = length;
+        fraction = memchr(&buffer[start], '.', length) != 0;
+        data->fieldType[data->fieldCount] = toInteger(&buffer[start], length, &integer)
+                                         || (fraction && toFloat(&buffer[start], length, &real)) ? 'n' : 'a';
+        data->fieldCount++;
+        if (buffer[i] != '\0')
+            buffer[i++] = '\0';
     }
+}
 
-    return sum;
+// Run the handler for the verb in field 0
+// commands[] has COMMAND_SLOTS entries placed at the COMMAND_HASH of their
+// verb, so the lookup is one hash and one compare
+// Returns false for an unknown verb or too few arguments
+bool dispatchCommand(USER_DATA *data, const COMMAND commands[])
+{
+    const COMMAND *command;
+    const char *verb;
+    uint8_t length;
+
+    if (data->fieldCount == 0)
+        return false;
+    verb = &data->buffer[data->fieldPosition[0]];
+    length = data->fieldLength[0];
+    command = &commands[COMMAND_HASH(verb[0], verb[length - 1], length)];
+    if (command->verb == 0 || strcmp(command->verb, verb) != 0
+        || data->fieldCount - 1 < command->minArguments)
+        return false;
+    command->handler(data);
+    return true;
 }
 
-// receive string input from a field
-char * getFieldString(USER_DATA* data, uint8_t fieldNumber)
+// Returns false if a verb is not at its COMMAND_HASH slot, so a mistyped
+// hash in the table is caught at startup instead of hiding the command
+bool checkCommands(const COMMAND commands[])
 {
-    char returnString[MAX_CHARS] = "";
+    const char *verb;
+    uint8_t slot, length;
 
-    if (fieldNumber >= MAX_FIELDS)
+    for (slot = 0; slot < COMMAND_SLOTS; slot++)
     {
-        return '\0';
+        verb = commands[slot].verb;
+        if (verb == 0)
+            continue;
+        length = strlen(verb);
+        if (length == 0 || COMMAND_HASH(verb[0], verb[length - 1], length) != slot)
+            return false;
     }
+    return true;
+}
 
-    int32_t i;
-
-    for (i = 0; data->buffer[i + data->fieldPosition[fieldNumber]] != '\0'; i++)
+// receive integer input from a field, 0 if it is not a number
+// fractions are truncated, values outside of int32_t are clamped
+int32_t getFieldInteger(USER_DATA* data, uint8_t fieldNumber)
+{
+    const char *str;
+    int32_t integer;
+    float real;
+
+    if (fieldNumber >= data->fieldCount)
+        return 0;
+    str = getFieldString(data, fieldNumber);
+    if (toInteger(str, data->fieldLength[fieldNumber], &integer))
+        return integer;
+    if (toFloat(str, data->fieldLength[fieldNumber], &real))
     {
-        returnString[i] = data->buffer[i + data->fieldPosition[fieldNumber]];
+        // a whole number only fails toInteger when it is out of range, its
+        // float can round back inside, e.g. 2147483648 to 2147483520
+        if (memchr(str, '.', data->fieldLength[fieldNumber]) == 0)
+            return real < 0 ? INT32_MIN : INT32_MAX;
+        if (real >= 2147483647.0f)
+            return INT32_MAX;
+        if (real <= -2147483648.0f)
+            return INT32_MIN;
+        return real;
     }
+    return 0;
+}
+
+// receive float input from a field, 0 if it is not a number
+float getFieldFloat(USER_DATA* data, uint8_t fieldNumber)
+{
+    int32_t integer;
+    float real;
+
+    if (fieldNumber >= data->fieldCount)
+        return 0;
+    if (toFloat(getFieldString(data, fieldNumber), data->fieldLength[fieldNumber], &real))
+        return real;
+    if (toInteger(getFieldString(data, fieldNumber), data->fieldLength[fieldNumber], &integer))
+        return integer;
+    return 0;
+}
 
-    return returnString;
+// receive string input from a field, points into data->buffer
+char * getFieldString(USER_DATA* data, uint8_t fieldNumber)
+{
+    if (fieldNumber >= data->fieldCount)
+        return 0;
+    return &data->buffer[data->fieldPosition[fieldNumber]];
 }
 
 
 // put an integer into UART buffer
 void putiUart0(int32_t num)
 {
-
-    int32_t i = 0;
-    int32_t total = num;
-    int32_t currentDigit = 0;
-    char outputString[99] = "";
-    if (total == 0)
-    {
-        outputString[0] = '0';
-    }
-
-    for (i = 0; total != 0; i++)
-    {
-        // digit will equal the remainder
-        currentDigit = total % 10;
-
-        // save value in a temporary string
-        outputString[i] = currentDigit + '0';
-
-        // move on to the next digit for the next iteration
-        total /= 10;
-    }
-
-    // find length of current string
-    for (i = 0; outputString[i] != '\0'; i++);
-
-    // length of string
-    int32_t length = i;
-
-    // j will be starting at the end of the string
-    int32_t j;
-    char tempChar;
-
-    // we will flip the string since it is on least significant digit
-    for (i = 0, j = length - 1; i < j; i++, j--)
-    {
-        tempChar = outputString[i];
-        outputString[i] = outputString[j];
-        outputString[j] = tempChar;
-    }
-
-   putsUart0(outputString);
+    fmt_i32(num);
 }
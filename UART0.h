@@ -20,32 +20,115 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include "telemetry.h"
 
 #define MAX_CHARS 80
-#define MAX_FIELDS 5
+#define MAX_FIELDS 8
+
+// TX ring buffer size, a power of 2
+#define UART0_TX_SIZE 256
+
+// RX ring buffer size, a power of 2
+#define UART0_RX_SIZE 128
+
+// uDMA TX frame size, at most 1024 (one basic transfer)
+#define UART0_FRAME_SIZE 256
+
+// Largest accepted baud rate error, 0.01%
+#define UART0_BAUD_TOLERANCE 150
+
+// Divisors and the rate they give
+typedef struct _UART0_BAUD
+{
+    uint32_t baudRate;                                  // actual rate
+    int16_t error;                                      // 0.01% of the requested rate
+    uint16_t ibrd;
+    uint8_t fbrd;
+    bool highSpeed;                                     // HSE, 8x oversampling
+} UART0_BAUD;
+
+// What uart0_write does when the TX ring is full
+typedef enum _UART0_POLICY
+{
+    UART0_BLOCK, UART0_DROP
+} UART0_POLICY;
+
+typedef struct _UART0_STATS
+{
+    uint16_t txHighWater;                               // most bytes waiting in the TX ring
+    uint32_t txDropped;
+    uint32_t rxDropped;                                 // received with the RX ring full
+} UART0_STATS;
 
 typedef struct _USER_DATA
 {
     char buffer[MAX_CHARS+1];
     uint8_t fieldCount;
     uint8_t fieldPosition[MAX_FIELDS];
+    uint8_t fieldLength[MAX_FIELDS];
     char fieldType[MAX_FIELDS];
 } USER_DATA;
 
+// Command table, COMMAND_SLOTS entries with each command at the slot given by
+// COMMAND_HASH of its first and last character and length
+// The table is built from a list macro that hands each command to X, e.g.
+//   #define COMMANDS(X) X('b', 'd', 4, "baud", 1, baudCommand) ...
+//   const COMMAND commands[COMMAND_SLOTS] = { COMMANDS(COMMAND_ENTRY) };
+//   COMMAND_SLOTS_UNIQUE(COMMANDS);
+// C lets a later initializer of a slot silently replace an earlier one, so
+// COMMAND_SLOTS_UNIQUE stops the build when two verbs share a slot: their
+// slot bits then OR to less than they add up to
+// checkCommands finds a hash that does not match its verb at startup
+#define COMMAND_SLOTS 16
+#define COMMAND_HASH(first, last, length) (((first) + 2 * (last) + (length)) & (COMMAND_SLOTS - 1))
+#define COMMAND_ENTRY(first, last, length, verb, minArguments, handler) \
+    [COMMAND_HASH(first, last, length)] = { verb, minArguments, handler },
+#define COMMAND_OR(first, last, length, verb, minArguments, handler) \
+    | (1u << COMMAND_HASH(first, last, length))
+#define COMMAND_ADD(first, last, length, verb, minArguments, handler) \
+    + (1u << COMMAND_HASH(first, last, length))
+#define COMMAND_SLOTS_UNIQUE(list) \
+    typedef char list##_SLOTS_UNIQUE[((0 list(COMMAND_OR)) == (0 list(COMMAND_ADD))) ? 1 : -1]
+
+typedef struct _COMMAND
+{
+    const char *verb;
+    uint8_t minArguments;
+    void (*handler)(USER_DATA *data);
+} COMMAND;
+
 
 // initializing UART
 void initUart0();
-void setUart0BaudRate(uint32_t baudRate, uint32_t fcyc);
+bool computeUart0Baud(uint32_t baudRate, uint32_t fcyc, UART0_BAUD *baud);
+bool setUart0BaudRate(uint32_t baudRate, uint32_t fcyc, UART0_BAUD *baud);
 void setupUart0();
 
 // putting info into UART
+uint16_t uart0_write(const char *data, uint16_t size);
+bool reserveUart0Tx(uint16_t size);
+void pushUart0Tx(char c);
+void commitUart0Tx(void);
+void setUart0TxPolicy(UART0_POLICY policy);
+uint16_t getUart0TxCount(void);
+void getUart0Stats(UART0_STATS *stats);
+void resetUart0Stats(void);
+void uart0Isr(void);
+
+// uDMA frames
+void enableUart0Dma(void);
+char *getUart0Frame(void);
+bool sendUart0Frame(uint16_t size);
+bool sendUart0Telemetry(TELEMETRY_ENCODER *e);
 void putcUart0(char c);
 void putsUart0(char* str);
 
 char getcUart0();
 bool kbhitUart0();
-//int32_t getsUart0(USER_DATA *data);
+bool getsUart0(USER_DATA *data);
 void parseFields(USER_DATA *data);
+bool dispatchCommand(USER_DATA *data, const COMMAND commands[]);
+bool checkCommands(const COMMAND commands[]);
 
 // get the content in a field
 int32_t getFieldInteger(USER_DATA* data, uint8_t fieldNumber);
@@ -0,0 +1,397 @@
+// ADS1115 Library
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    40 MHz
+
+// Hardware configuration:
+// ADS1115 16-bit ADCs on any of I2C0-I2C3, ADDR pin selects address 0x48-0x4B
+// ALERT/RDY of every device wired together on PB5 with internal pull-up,
+// rising edge marks conversions ready
+// Timer 2A one-shot bounds the wait for ALERT/RDY
+
+//-----------------------------------------------------------------------------
+// Device includes, defines, and assembler directives
+//-----------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "tm4c123gh6pm.h"
+#include "gpio.h"
+#include "i2c.h"
+#include "wait.h"
+#include "ads1115.h"
+
+// Pins
+#define ALERT_RDY PORTB,5
+
+// Config register fields
+#define OS_SINGLE       0x8000
+#define MUX_S           12
+#define MUX_M           (0x7 << MUX_S)
+#define PGA_S           9
+#define PGA_M           (0x7 << PGA_S)
+#define MODE_S          8
+#define MODE_M          (0x1 << MODE_S)
+#define DR_S            5
+#define DR_M            (0x7 << DR_S)
+#define COMP_MODE_S     4
+#define COMP_POL_S      3
+#define COMP_LAT_S      2
+#define COMP_QUE_S      0
+#define COMP_M          0x1F
+
+// Power-on default: AIN0-AIN1, +/-2.048 V, single-shot, 128 SPS, comparator off
+#define CONFIG_DEFAULT  0x0583
+
+// Timer 2A clocks per microsecond
+#define TIMER_CLOCKS_PER_US 40
+
+// Bytes on the bus per transaction, address and pointer bytes included
+#define WRITE_BYTES     4                               // add+w, pointer, msb, lsb
+#define READ_BYTES      5                               // add+w, pointer, add+r, msb, lsb
+
+//-----------------------------------------------------------------------------
+// Global variables
+//-----------------------------------------------------------------------------
+
+// Set by the ALERT/RDY edge, cleared when the result is consumed
+static volatile bool conversionReady = false;
+static volatile uint32_t readyCount = 0;
+
+// Set by the Timer 2A time-out of waitAds1115Ready
+static volatile bool readyTimeout = false;
+
+//-----------------------------------------------------------------------------
+// Subroutines
+//-----------------------------------------------------------------------------
+
+static void writeAds1115Register(ADS1115 *dev, uint8_t reg, uint16_t value)
+{
+    uint8_t data[2];
+
+    data[0] = value >> 8;
+    data[1] = value & 0xFF;
+    writeI2cRegisters(dev->bus, dev->add, reg, data, 2);
+    dev->busBytes += WRITE_BYTES;
+}
+
+// Put the device in a known state so the shadow matches it without a read
+void initAds1115(ADS1115 *dev, I2C_BUS *bus, uint8_t add)
+{
+    dev->bus = bus;
+    dev->add = add;
+    dev->config = CONFIG_DEFAULT;
+    dev->readyInterrupt = false;
+    dev->busBytes = 0;
+    writeAds1115Register(dev, ADS1115_CONFIG, CONFIG_DEFAULT);
+    dev->written = CONFIG_DEFAULT;
+}
+
+void setAds1115Mux(ADS1115 *dev, ADS1115_MUX mux)
+{
+    dev->config = (dev->config & ~MUX_M) | (mux << MUX_S);
+}
+
+void setAds1115Pga(ADS1115 *dev, ADS1115_PGA pga)
+{
+    dev->config = (dev->config & ~PGA_M) | (pga << PGA_S);
+}
+
+void setAds1115Mode(ADS1115 *dev, ADS1115_MODE mode)
+{
+    dev->config = (dev->config & ~MODE_M) | (mode << MODE_S);
+}
+
+void setAds1115DataRate(ADS1115 *dev, ADS1115_DR dr)
+{
+    dev->config = (dev->config & ~DR_M) | (dr << DR_S);
+}
+
+void setAds1115Comparator(ADS1115 *dev, ADS1115_COMP_MODE mode, ADS1115_COMP_POL pol, bool latch, ADS1115_COMP_QUE que)
+{
+    dev->config = (dev->config & ~COMP_M) | (mode << COMP_MODE_S) | (pol << COMP_POL_S)
+                | (latch << COMP_LAT_S) | (que << COMP_QUE_S);
+}
+
+// Write the config register only if the shadow differs from the device
+// Returns true if a write was issued
+bool updateAds1115Config(ADS1115 *dev)
+{
+    if (dev->config == dev->written)
+        return false;
+    writeAds1115Register(dev, ADS1115_CONFIG, dev->config);
+    dev->written = dev->config;
+    return true;
+}
+
+// In single-shot mode every conversion needs a config write with OS set, so
+// the pending shadow changes go out in that same write
+// In continuous mode the device is already converting and only changes are sent
+void startAds1115Conversion(ADS1115 *dev)
+{
+    if (dev->config & MODE_M)
+    {
+        writeAds1115Register(dev, ADS1115_CONFIG, dev->config | OS_SINGLE);
+        dev->written = dev->config;
+    }
+    else
+        updateAds1115Config(dev);
+}
+
+int16_t readAds1115Conversion(ADS1115 *dev)
+{
+    uint8_t data[2];
+
+    readI2cRegisters(dev->bus, dev->add, ADS1115_CONVERSION, data, 2);
+    dev->busBytes += READ_BYTES;
+    return (int16_t)((data[0] << 8) | data[1]);
+}
+
+ADS1115_PGA getAds1115Pga(ADS1115 *dev)
+{
+    return (ADS1115_PGA)((dev->config & PGA_M) >> PGA_S);
+}
+
+uint32_t getAds1115BusBytes(ADS1115 *dev)
+{
+    return dev->busBytes;
+}
+
+// Convert raw counts to uV for a PGA setting
+// LSB = FSR / 32768 = (FSR / 256 mV) * 7.8125 uV, with 7.8125 = 125 / 16
+int32_t ads1115RawToUv(int16_t raw, ADS1115_PGA pga)
+{
+    static const uint8_t fsrOver256[] = { 24, 16, 8, 4, 2, 1 };
+    if (pga > ADS1115_PGA_256)
+        pga = ADS1115_PGA_256;                          // codes 6 and 7 are also +/-0.256 V
+    return ((int32_t)raw * fsrOver256[pga] * 125) / 16;
+}
+
+// Use the comparator as a conversion-ready signal: with Hi_thresh MSB set and
+// Lo_thresh MSB clear, ALERT/RDY is asserted at the end of a single-shot
+// conversion and pulses for 8 us after each continuous one
+// Active high on the open-drain outputs: a converting device holds the shared
+// line low, so it rises when the last device of a scan finishes
+void enableAds1115ReadyInterrupt(ADS1115 *dev)
+{
+    writeAds1115Register(dev, ADS1115_HI_THRESH, 0x8000);
+    writeAds1115Register(dev, ADS1115_LO_THRESH, 0x0000);
+    setAds1115Comparator(dev, ADS1115_COMP_TRADITIONAL, ADS1115_COMP_ACTIVE_HIGH, false, ADS1115_COMP_QUE_1);
+    updateAds1115Config(dev);
+
+    enablePort(PORTB);
+    selectPinDigitalInput(ALERT_RDY);
+    enablePinPullup(ALERT_RDY);
+    selectPinInterruptRisingEdge(ALERT_RDY);
+    clearPinInterrupt(ALERT_RDY);
+    enablePinInterrupt(ALERT_RDY);
+    NVIC_EN0_R |= 1 << (INT_GPIOB - 16);
+
+    // Timer 2A, one-shot started by each wait
+    SYSCTL_RCGCTIMER_R |= SYSCTL_RCGCTIMER_R2;
+    _delay_cycles(3);
+    TIMER2_CTL_R &= ~TIMER_CTL_TAEN;
+    TIMER2_CFG_R = TIMER_CFG_32_BIT_TIMER;
+    TIMER2_TAMR_R = TIMER_TAMR_TAMR_1_SHOT;
+    TIMER2_IMR_R = TIMER_IMR_TATOIM;
+    NVIC_EN0_R |= 1 << (INT_TIMER2A - 16);
+    dev->readyInterrupt = true;
+}
+
+// GPIO port B interrupt, only ALERT/RDY is enabled on the port
+void ads1115AlertIsr(void)
+{
+    clearPinInterrupt(ALERT_RDY);
+    conversionReady = true;
+    readyCount++;
+}
+
+// Timer 2A, the wait for ALERT/RDY timed out
+void ads1115TimerIsr(void)
+{
+    TIMER2_ICR_R = TIMER_ICR_TATOCINT;
+    readyTimeout = true;
+}
+
+bool isAds1115Ready(void)
+{
+    return conversionReady;
+}
+
+void clearAds1115Ready(void)
+{
+    conversionReady = false;
+}
+
+// Wait up to timeoutUs for the next ALERT/RDY edge, then mark it consumed
+// The core sleeps until the edge or the Timer 2A time-out interrupt, the
+// flags are checked with interrupts disabled so a wake cannot be missed
+// Returns false on timeout, so a device that never signals cannot hang a scan
+bool waitAds1115Ready(uint32_t timeoutUs)
+{
+    bool ready;
+
+    TIMER2_CTL_R &= ~TIMER_CTL_TAEN;
+    TIMER2_TAILR_R = timeoutUs * TIMER_CLOCKS_PER_US;
+    TIMER2_ICR_R = TIMER_ICR_TATOCINT;
+    readyTimeout = false;
+    TIMER2_CTL_R |= TIMER_CTL_TAEN;
+    while (true)
+    {
+        disableInterrupts();
+        if (conversionReady || readyTimeout)
+            break;
+        waitForInterrupt();
+        enableInterrupts();
+    }
+    enableInterrupts();
+    TIMER2_CTL_R &= ~TIMER_CTL_TAEN;
+    ready = conversionReady;
+    conversionReady = false;
+    return ready;
+}
+
+// Number of conversions signalled since reset
+uint32_t getAds1115ReadyCount(void)
+{
+    return readyCount;
+}
+
+// Worst-case conversion time in us for a data rate
+// Nominal period plus 10% for the internal oscillator tolerance
+uint32_t getAds1115ConversionUs(ADS1115_DR dr)
+{
+    static const uint32_t periodUs[] = { 125000, 62500, 31250, 15625, 7813, 4000, 2106, 1163 };
+    return periodUs[dr] + periodUs[dr] / 10;
+}
+
+static void selectAds1115Channel(ADS1115 *dev, const ADS1115_CHANNEL *ch)
+{
+    setAds1115Mux(dev, ch->mux);
+    setAds1115Pga(dev, ch->pga);
+    setAds1115DataRate(dev, ch->dr);
+}
+
+// Queue a scan batch on the device's bus
+// A full queue fails the batch at once with I2C_QUEUE_FULL, so the wait
+// returns and the retry waits out the queue without a bus recovery
+static void queueAds1115Batch(ADS1115 *dev, I2C_BATCH *b)
+{
+    if (!queueI2cBatch(dev->bus, b))
+    {
+        b->bus = dev->bus;
+        b->status = I2C_QUEUE_FULL;
+    }
+}
+
+// Wait for the queued batches of a scan step, the bits of queued select
+// them, then retry the failed ones one at a time
+// The retries wait until every bus queue of the step is idle, so a bus
+// recovery cannot cut into another device's transfer
+// Returns false if a batch still failed after its retries
+static bool finishAds1115Batches(ADS1115 *dev[], I2C_BATCH batch[], uint8_t queued, uint8_t count)
+{
+    I2C_STATUS status[ADS1115_SCAN_MAX];
+    bool ok = true;
+    uint8_t i;
+
+    for (i = 0; i < count; i++)
+        if (queued & (1 << i))
+            status[i] = waitI2cBatch(&batch[i]);
+    for (i = 0; i < count; i++)
+        if (queued & (1 << i))
+            ok &= retryI2cBatch(dev[i]->bus, &batch[i], status[i], I2C_RETRIES) == I2C_DONE;
+    return ok;
+}
+
+// Scan one channel on each of several devices in single-shot mode
+// Conversions are started on every device, then all results are collected
+// once the shared ALERT/RDY line rises, or after the slowest conversion time
+// when a device has the ready interrupt off; transfers on different buses
+// overlap, devices sharing a bus are serialized by its queue
+// A channel with discard set is converted that many extra times first
+// Failed transfers are retried I2C_RETRIES times with backoff
+// Returns false if any transfer still failed or the ready edge never came
+bool scanAds1115(ADS1115 *dev[], const ADS1115_CHANNEL *ch[], int16_t result[], uint8_t count)
+{
+    uint8_t pointer = ADS1115_CONVERSION;
+    uint8_t config[ADS1115_SCAN_MAX][3];
+    uint8_t data[ADS1115_SCAN_MAX][2];
+    I2C_TRANSACTION t[ADS1115_SCAN_MAX];
+    I2C_BATCH batch[ADS1115_SCAN_MAX];
+    uint32_t waitUs = 0;
+    bool useReady = true;
+    bool ok = true;
+    uint8_t queued, pass, i;
+
+    if (count > ADS1115_SCAN_MAX)
+        count = ADS1115_SCAN_MAX;
+
+    for (i = 0; i < count; i++)
+    {
+        selectAds1115Channel(dev[i], ch[i]);
+        setAds1115Mode(dev[i], ADS1115_MODE_SINGLE_SHOT);
+        config[i][0] = ADS1115_CONFIG;
+        config[i][1] = (dev[i]->config | OS_SINGLE) >> 8;
+        config[i][2] = dev[i]->config & 0xFF;
+        if (getAds1115ConversionUs(ch[i]->dr) > waitUs)
+            waitUs = getAds1115ConversionUs(ch[i]->dr);
+        useReady &= dev[i]->readyInterrupt;
+    }
+
+    // start, once per discarded conversion and once for the result
+    for (pass = 0; ; pass++)
+    {
+        queued = 0;
+        for (i = 0; i < count; i++)
+        {
+            if (pass > ch[i]->discard)
+                continue;
+            t[i].add = dev[i]->add;
+            t[i].writeData = config[i];
+            t[i].writeSize = 3;
+            t[i].readData = 0;
+            t[i].readSize = 0;
+            batch[i].t = &t[i];
+            batch[i].count = 1;
+            batch[i].callback = 0;
+            queueAds1115Batch(dev[i], &batch[i]);
+            dev[i]->written = dev[i]->config;
+            dev[i]->busBytes += WRITE_BYTES;
+            queued |= 1 << i;
+        }
+        if (queued == 0)
+            break;
+        ok &= finishAds1115Batches(dev, batch, queued, count);
+
+        // an early finisher may have raised the line before the last start,
+        // only the rise after every device is converting counts
+        if (useReady)
+        {
+            clearAds1115Ready();
+            ok &= waitAds1115Ready(waitUs + waitUs / 2);
+        }
+        else
+            waitMicrosecond(waitUs);
+    }
+
+    // collect
+    for (i = 0; i < count; i++)
+    {
+        t[i].writeData = &pointer;
+        t[i].writeSize = 1;
+        t[i].readData = data[i];
+        t[i].readSize = 2;
+        queueAds1115Batch(dev[i], &batch[i]);
+        dev[i]->busBytes += READ_BYTES;
+    }
+    ok &= finishAds1115Batches(dev, batch, (1 << count) - 1, count);
+    for (i = 0; i < count; i++)
+        result[i] = (int16_t)((data[i][0] << 8) | data[i][1]);
+    return ok;
+}
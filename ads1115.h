@@ -0,0 +1,158 @@
+// ADS1115 Library
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    40 MHz
+
+// Hardware configuration:
+// ADS1115 16-bit ADC on I2C bus 0, ADDR pin selects address 0x48-0x4B
+// ALERT/RDY of every device wired together on PB5 with internal pull-up,
+// rising edge marks conversions ready
+// Timer 2A one-shot bounds the wait for ALERT/RDY
+
+//-----------------------------------------------------------------------------
+// Device includes, defines, and assembler directives
+//-----------------------------------------------------------------------------
+
+#ifndef ADS1115_H_
+#define ADS1115_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "i2c.h"
+
+// Register pointers
+#define ADS1115_CONVERSION 0
+#define ADS1115_CONFIG     1
+#define ADS1115_LO_THRESH  2
+#define ADS1115_HI_THRESH  3
+
+// Devices per scan
+#define ADS1115_SCAN_MAX   8
+
+// Input multiplexer (positive input - negative input)
+typedef enum _ADS1115_MUX
+{
+    ADS1115_MUX_AIN0_AIN1,
+    ADS1115_MUX_AIN0_AIN3,
+    ADS1115_MUX_AIN1_AIN3,
+    ADS1115_MUX_AIN2_AIN3,
+    ADS1115_MUX_AIN0_GND,
+    ADS1115_MUX_AIN1_GND,
+    ADS1115_MUX_AIN2_GND,
+    ADS1115_MUX_AIN3_GND
+} ADS1115_MUX;
+
+// Programmable gain, full scale range in mV
+typedef enum _ADS1115_PGA
+{
+    ADS1115_PGA_6144,
+    ADS1115_PGA_4096,
+    ADS1115_PGA_2048,
+    ADS1115_PGA_1024,
+    ADS1115_PGA_512,
+    ADS1115_PGA_256
+} ADS1115_PGA;
+
+typedef enum _ADS1115_MODE
+{
+    ADS1115_MODE_CONTINUOUS,
+    ADS1115_MODE_SINGLE_SHOT
+} ADS1115_MODE;
+
+// Data rate in samples per second
+typedef enum _ADS1115_DR
+{
+    ADS1115_DR_8,
+    ADS1115_DR_16,
+    ADS1115_DR_32,
+    ADS1115_DR_64,
+    ADS1115_DR_128,
+    ADS1115_DR_250,
+    ADS1115_DR_475,
+    ADS1115_DR_860
+} ADS1115_DR;
+
+typedef enum _ADS1115_COMP_MODE
+{
+    ADS1115_COMP_TRADITIONAL,
+    ADS1115_COMP_WINDOW
+} ADS1115_COMP_MODE;
+
+typedef enum _ADS1115_COMP_POL
+{
+    ADS1115_COMP_ACTIVE_LOW,
+    ADS1115_COMP_ACTIVE_HIGH
+} ADS1115_COMP_POL;
+
+typedef enum _ADS1115_COMP_QUE
+{
+    ADS1115_COMP_QUE_1,
+    ADS1115_COMP_QUE_2,
+    ADS1115_COMP_QUE_4,
+    ADS1115_COMP_QUE_DISABLE
+} ADS1115_COMP_QUE;
+
+// The config register is never read back, the shadow holds what the device
+// has (written) and what the next write will send (config)
+typedef struct _ADS1115
+{
+    I2C_BUS *bus;
+    uint8_t add;
+    uint16_t config;
+    uint16_t written;
+    uint32_t busBytes;                                  // bytes on the bus, including address bytes
+    bool readyInterrupt;                                // ALERT/RDY edge marks results
+} ADS1115;
+
+// Acquisition descriptor for one input
+// discard is the number of extra conversions thrown away after switching to
+// the channel, for inputs whose front end needs time to settle
+typedef struct _ADS1115_CHANNEL
+{
+    ADS1115_MUX mux;
+    ADS1115_PGA pga;
+    ADS1115_DR dr;
+    uint8_t discard;
+} ADS1115_CHANNEL;
+
+//-----------------------------------------------------------------------------
+// Subroutines
+//-----------------------------------------------------------------------------
+
+void initAds1115(ADS1115 *dev, I2C_BUS *bus, uint8_t add);
+
+// Typed setters only change the shadow, nothing goes on the bus
+void setAds1115Mux(ADS1115 *dev, ADS1115_MUX mux);
+void setAds1115Pga(ADS1115 *dev, ADS1115_PGA pga);
+void setAds1115Mode(ADS1115 *dev, ADS1115_MODE mode);
+void setAds1115DataRate(ADS1115 *dev, ADS1115_DR dr);
+void setAds1115Comparator(ADS1115 *dev, ADS1115_COMP_MODE mode, ADS1115_COMP_POL pol, bool latch, ADS1115_COMP_QUE que);
+
+// Bus access
+bool updateAds1115Config(ADS1115 *dev);
+void startAds1115Conversion(ADS1115 *dev);
+int16_t readAds1115Conversion(ADS1115 *dev);
+
+// Conversion ready signalling on ALERT/RDY
+void enableAds1115ReadyInterrupt(ADS1115 *dev);
+void ads1115AlertIsr(void);
+void ads1115TimerIsr(void);
+bool isAds1115Ready(void);
+void clearAds1115Ready(void);
+bool waitAds1115Ready(uint32_t timeoutUs);
+uint32_t getAds1115ReadyCount(void);
+
+// Acquisition
+uint32_t getAds1115ConversionUs(ADS1115_DR dr);
+bool scanAds1115(ADS1115 *dev[], const ADS1115_CHANNEL *ch[], int16_t result[], uint8_t count);
+
+ADS1115_PGA getAds1115Pga(ADS1115 *dev);
+uint32_t getAds1115BusBytes(ADS1115 *dev);
+int32_t ads1115RawToUv(int16_t raw, ADS1115_PGA pga);
+
+#endif
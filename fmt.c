@@ -0,0 +1,127 @@
+// Formatting Library
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    40 MHz
+
+// Hardware configuration:
+// UART0, characters are stored straight into its TX ring
+
+//-----------------------------------------------------------------------------
+// Device includes, defines, and assembler directives
+//-----------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "uart0.h"
+#include "fmt.h"
+
+#define DECIMALS_MAX 9
+
+//-----------------------------------------------------------------------------
+// Global variables
+//-----------------------------------------------------------------------------
+
+static const uint32_t pow10[10] =
+{
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+};
+
+//-----------------------------------------------------------------------------
+// Subroutines
+//-----------------------------------------------------------------------------
+
+// Number of decimal digits, at least 1
+static uint8_t countDigits(uint32_t value)
+{
+    uint8_t n = 1;
+    while (n < 10 && value >= pow10[n])
+        n++;
+    return n;
+}
+
+// Push the low n decimal digits, most significant first, so no reversal pass
+// is needed
+static void pushDigits(uint32_t value, uint8_t n)
+{
+    uint32_t digit;
+    while (n--)
+    {
+        digit = value / pow10[n];
+        value -= digit * pow10[n];
+        pushUart0Tx('0' + digit);
+    }
+}
+
+void fmt_u32(uint32_t value)
+{
+    uint8_t n = countDigits(value);
+    if (reserveUart0Tx(n))
+    {
+        pushDigits(value, n);
+        commitUart0Tx();
+    }
+}
+
+// The magnitude is taken unsigned so INT32_MIN is printed correctly
+void fmt_i32(int32_t value)
+{
+    bool negative = value < 0;
+    uint32_t magnitude = negative ? 0u - (uint32_t)value : (uint32_t)value;
+    uint8_t n = countDigits(magnitude);
+
+    if (reserveUart0Tx(n + negative))
+    {
+        if (negative)
+            pushUart0Tx('-');
+        pushDigits(magnitude, n);
+        commitUart0Tx();
+    }
+}
+
+// Upper case, no prefix or leading zeros
+void fmt_u32_hex(uint32_t value)
+{
+    static const char hex[] = "0123456789ABCDEF";
+    uint8_t n = 1;
+
+    while (n < 8 && (value >> (n * 4)) != 0)
+        n++;
+    if (reserveUart0Tx(n))
+    {
+        while (n--)
+            pushUart0Tx(hex[(value >> (n * 4)) & 0xF]);
+        commitUart0Tx();
+    }
+}
+
+// Fixed point value scaled by 10^decimals, e.g. fmt_fixed(-5, 2) is -0.05
+void fmt_fixed(int32_t value, uint8_t decimals)
+{
+    bool negative = value < 0;
+    uint32_t magnitude = negative ? 0u - (uint32_t)value : (uint32_t)value;
+    uint32_t whole, fraction;
+    uint8_t n;
+
+    if (decimals > DECIMALS_MAX)
+        decimals = DECIMALS_MAX;
+    whole = magnitude / pow10[decimals];
+    fraction = magnitude - whole * pow10[decimals];
+    n = countDigits(whole);
+    if (reserveUart0Tx(negative + n + (decimals ? decimals + 1 : 0)))
+    {
+        if (negative)
+            pushUart0Tx('-');
+        pushDigits(whole, n);
+        if (decimals)
+        {
+            pushUart0Tx('.');
+            pushDigits(fraction, decimals);
+        }
+        commitUart0Tx();
+    }
+}
@@ -0,0 +1,32 @@
+// Formatting Library
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    40 MHz
+
+// Hardware configuration:
+// UART0, characters are stored straight into its TX ring
+
+//-----------------------------------------------------------------------------
+// Device includes, defines, and assembler directives
+//-----------------------------------------------------------------------------
+
+#ifndef FMT_H_
+#define FMT_H_
+
+#include <stdint.h>
+
+//-----------------------------------------------------------------------------
+// Subroutines
+//-----------------------------------------------------------------------------
+
+void fmt_u32(uint32_t value);
+void fmt_i32(int32_t value);
+void fmt_u32_hex(uint32_t value);
+void fmt_fixed(int32_t value, uint8_t decimals);
+
+#endif
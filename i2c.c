@@ -0,0 +1,659 @@
+// I2C Library
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    40 MHz
+
+// Hardware configuration:
+// I2C0 on PB2 (SCL) / PB3 (SDA)
+// I2C1 on PA6 (SCL) / PA7 (SDA)
+// I2C2 on PE4 (SCL) / PE5 (SDA)
+// I2C3 on PD0 (SCL) / PD1 (SDA)
+// 2kohm pullups on SDA and SCL of each bus in use
+
+//-----------------------------------------------------------------------------
+// Device includes, defines, and assembler directives
+//-----------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "tm4c123gh6pm.h"
+#include "gpio.h"
+#include "wait.h"
+#include "i2c_fsm.h"
+#include "i2c.h"
+
+// Master register offsets, the same for every module
+#define MSA             0x000
+#define MCS             0x004
+#define MDR             0x008
+#define MTPR            0x00C
+#define MIMR            0x010
+#define MRIS            0x014
+#define MICR            0x01C
+#define MCR             0x020
+#define MCLKOCNT        0x024
+
+#define REG(base, offset) (*((volatile uint32_t *)((base) + (offset))))
+
+//-----------------------------------------------------------------------------
+// Global variables
+//-----------------------------------------------------------------------------
+
+// Only the hardware description is given, the driver state starts zeroed
+I2C_BUS i2cBus[I2C_BUS_COUNT] =
+{
+    { .base = 0x40020000, .irq = INT_I2C0, .rcgc = SYSCTL_RCGCI2C_R0, .port = PORTB, .sclPin = 2, .sdaPin = 3,
+      .sclPctl = GPIO_PCTL_PB2_I2C0SCL, .sdaPctl = GPIO_PCTL_PB3_I2C0SDA },
+    { .base = 0x40021000, .irq = INT_I2C1, .rcgc = SYSCTL_RCGCI2C_R1, .port = PORTA, .sclPin = 6, .sdaPin = 7,
+      .sclPctl = GPIO_PCTL_PA6_I2C1SCL, .sdaPctl = GPIO_PCTL_PA7_I2C1SDA },
+    { .base = 0x40022000, .irq = INT_I2C2, .rcgc = SYSCTL_RCGCI2C_R2, .port = PORTE, .sclPin = 4, .sdaPin = 5,
+      .sclPctl = GPIO_PCTL_PE4_I2C2SCL, .sdaPctl = GPIO_PCTL_PE5_I2C2SDA },
+    { .base = 0x40023000, .irq = INT_I2C3, .rcgc = SYSCTL_RCGCI2C_R3, .port = PORTD, .sclPin = 0, .sdaPin = 1,
+      .sclPctl = GPIO_PCTL_PD0_I2C3SCL, .sdaPctl = GPIO_PCTL_PD1_I2C3SDA },
+};
+
+//-----------------------------------------------------------------------------
+// Subroutines
+//-----------------------------------------------------------------------------
+
+// The NVIC enable and disable registers are consecutive words of 32 interrupts
+static void enableI2cInterrupt(I2C_BUS *bus)
+{
+    (&NVIC_EN0_R)[(bus->irq - 16) / 32] = 1 << ((bus->irq - 16) % 32);
+}
+
+static void disableI2cInterrupt(I2C_BUS *bus)
+{
+    (&NVIC_DIS0_R)[(bus->irq - 16) / 32] = 1 << ((bus->irq - 16) % 32);
+}
+
+// SCL period = 2 * (1 + TPR) * (SCL_LP + SCL_HP) / sysclk
+// Standard, fast and fast-mode plus use LP=6, HP=4; high-speed uses LP=2, HP=1
+// TPR is rounded up so the bus never runs faster than requested
+// A rate of 0 selects standard mode
+// Returns the actual SCL rate
+uint32_t initI2c(I2C_BUS *bus, uint32_t sysclk, uint32_t sclHz)
+{
+    uint32_t clocksPerTpr, tpr, actualHz;
+
+    if (sclHz == 0)
+        sclHz = I2C_STANDARD_HZ;
+    clocksPerTpr = (sclHz > I2C_FM_PLUS_HZ) ? 2 * 3 : 2 * 10;
+    tpr = (sysclk + clocksPerTpr * sclHz - 1) / (clocksPerTpr * sclHz) - 1;
+    if (tpr < 1)
+        tpr = 1;
+    if (tpr > I2C_MTPR_TPR_M)
+        tpr = I2C_MTPR_TPR_M;
+    actualHz = sysclk / (clocksPerTpr * (tpr + 1));
+
+    // Enable clocks
+    SYSCTL_RCGCI2C_R |= bus->rcgc;
+    _delay_cycles(3);
+    enablePort(bus->port);
+
+    // Configure I2C
+    selectPinPushPullOutput(bus->port, bus->sclPin);
+    setPinAuxFunction(bus->port, bus->sclPin, bus->sclPctl);
+    selectPinOpenDrainOutput(bus->port, bus->sdaPin);
+    setPinAuxFunction(bus->port, bus->sdaPin, bus->sdaPctl);
+
+    // Configure I2C peripheral
+    // In high-speed mode every START also sends the master code at fast-mode speed
+    REG(bus->base, MCR) = 0;                            // disable to program
+    if (sclHz > I2C_FM_PLUS_HZ)
+    {
+        REG(bus->base, MTPR) = I2C_MTPR_HS | tpr;
+        bus->startFlags = I2C_MCS_HS;
+    }
+    else
+    {
+        REG(bus->base, MTPR) = tpr;                     // 40 MHz: 19 = 100kbps, 4 = 400kbps, 1 = 1Mbps
+        bus->startFlags = 0;
+    }
+    REG(bus->base, MCR) = I2C_MCR_MFE;                  // master
+    REG(bus->base, MCS) = I2C_MCS_STOP;
+    REG(bus->base, MCLKOCNT) = I2C_MCLKOCNT_CNTL_M;     // longest clock-low timeout
+    bus->byteNs = 9000000000ULL / actualHz;
+    bus->timeoutLoops = sysclk / 1000000 * I2C_TIMEOUT_US / 4;  // 4+ cycles per poll
+    bus->status = I2C_DONE;
+    bus->fsm.startFlags = bus->startFlags;
+
+    // Master interrupt is unmasked only while a transaction is queued,
+    // so the polled functions below are unaffected
+    REG(bus->base, MIMR) = 0;
+    bus->fsm.t = 0;
+    enableI2cInterrupt(bus);
+    return actualHz;
+}
+
+// Record the outcome of a transfer and count failures by type
+static void setI2cStatus(I2C_BUS *bus, I2C_STATUS status)
+{
+    bus->status = status;
+    if (status > I2C_DONE)
+        bus->stats.errors[status]++;
+}
+
+// Bounded wait for the master interrupt flag
+static bool waitI2c(I2C_BUS *bus)
+{
+    uint32_t loops = bus->timeoutLoops;
+    while ((REG(bus->base, MRIS) & I2C_MRIS_RIS) == 0)
+        if (--loops == 0)
+            return false;
+    return true;
+}
+
+// Start a polled transfer, fails if a stuck slave or another master holds the bus
+static bool beginI2c(I2C_BUS *bus)
+{
+    if (REG(bus->base, MCS) & I2C_MCS_BUSBSY)
+    {
+        setI2cStatus(bus, I2C_BUS_BUSY);
+        return false;
+    }
+    bus->status = I2C_DONE;
+    return true;
+}
+
+// Issue one master command and wait for it
+// A nack in a command without STOP is ended with a STOP here
+static bool runI2c(I2C_BUS *bus, uint32_t mcs)
+{
+    uint32_t status;
+
+    REG(bus->base, MICR) = I2C_MICR_IC;
+    REG(bus->base, MCS) = mcs;
+    if (!waitI2c(bus))
+    {
+        setI2cStatus(bus, I2C_TIMEOUT);
+        return false;
+    }
+    status = REG(bus->base, MCS);
+    if (status & I2C_MCS_ARBLST)
+    {
+        setI2cStatus(bus, I2C_ARB_LOST);
+        return false;
+    }
+    if (status & I2C_MCS_ERROR)
+    {
+        setI2cStatus(bus, (status & I2C_MCS_ADRACK) ? I2C_ADDR_NACK : I2C_DATA_NACK);
+        if (!(mcs & I2C_MCS_STOP))
+        {
+            REG(bus->base, MICR) = I2C_MICR_IC;
+            REG(bus->base, MCS) = I2C_MCS_STOP;
+            waitI2c(bus);
+        }
+        return false;
+    }
+    return true;
+}
+
+// For simple devices with a single internal register
+void writeI2cData(I2C_BUS *bus, uint8_t add, uint8_t data)
+{
+    if (!beginI2c(bus))
+        return;
+    REG(bus->base, MSA) = add << 1; // add:r/~w=0
+    REG(bus->base, MDR) = data;
+    runI2c(bus, bus->startFlags | I2C_MCS_START | I2C_MCS_RUN | I2C_MCS_STOP);
+}
+
+uint8_t readI2cData(I2C_BUS *bus, uint8_t add)
+{
+    if (!beginI2c(bus))
+        return 0;
+    REG(bus->base, MSA) = (add << 1) | 1; // add:r/~w=1
+    runI2c(bus, bus->startFlags | I2C_MCS_START | I2C_MCS_RUN | I2C_MCS_STOP);
+    return REG(bus->base, MDR);
+}
+
+// For devices with multiple registers
+void writeI2cRegister(I2C_BUS *bus, uint8_t add, uint8_t reg, uint8_t data)
+{
+    if (!beginI2c(bus))
+        return;
+
+    // send address and register
+    REG(bus->base, MSA) = add << 1 | 0; // add:r/~w=0
+    REG(bus->base, MDR) = reg;
+    if (!runI2c(bus, bus->startFlags | I2C_MCS_START | I2C_MCS_RUN))
+        return;
+
+    // write data to register
+    REG(bus->base, MDR) = data;
+    runI2c(bus, I2C_MCS_RUN | I2C_MCS_STOP);
+}
+
+void writeI2cRegisters(I2C_BUS *bus, uint8_t add, uint8_t reg, const uint8_t data[], uint8_t size)
+{
+    uint8_t i;
+    if (!beginI2c(bus))
+        return;
+
+    // send address and register
+    REG(bus->base, MSA) = add << 1 | 0; // add:r/~w=0
+    REG(bus->base, MDR) = reg;
+    if (size == 0)
+        runI2c(bus, bus->startFlags | I2C_MCS_START | I2C_MCS_RUN | I2C_MCS_STOP);
+    else
+    {
+        if (!runI2c(bus, bus->startFlags | I2C_MCS_START | I2C_MCS_RUN))
+            return;
+        // first size-1 bytes
+        for (i = 0; i < size-1; i++)
+        {
+            REG(bus->base, MDR) = data[i];
+            if (!runI2c(bus, I2C_MCS_RUN))
+                return;
+        }
+        // last byte
+        REG(bus->base, MDR) = data[size-1];
+        runI2c(bus, I2C_MCS_RUN | I2C_MCS_STOP);
+    }
+}
+
+uint8_t readI2cRegister(I2C_BUS *bus, uint8_t add, uint8_t reg)
+{
+    if (!beginI2c(bus))
+        return 0;
+
+    // set internal register counter in device
+    REG(bus->base, MSA) = add << 1; // add:r/~w=0
+    REG(bus->base, MDR) = reg;
+    if (!runI2c(bus, bus->startFlags | I2C_MCS_START | I2C_MCS_RUN))
+        return 0;
+
+    // read data from register
+    REG(bus->base, MSA) = (add << 1) | 1; // add:r/~w=1
+    runI2c(bus, bus->startFlags | I2C_MCS_START | I2C_MCS_RUN | I2C_MCS_STOP);
+    return REG(bus->base, MDR);
+}
+
+void readI2cRegisters(I2C_BUS *bus, uint8_t add, uint8_t reg, uint8_t data[], uint8_t size)
+{
+    uint8_t i = 0;
+    if (!beginI2c(bus))
+        return;
+
+    // send address and register number
+    REG(bus->base, MSA) = add << 1; // add:r/~w=0
+    REG(bus->base, MDR) = reg;
+    if (!runI2c(bus, bus->startFlags | I2C_MCS_START | I2C_MCS_RUN))
+        return;
+
+    if (size == 1)
+    {
+        // add and read one byte
+        REG(bus->base, MSA) = (add << 1) | 1; // add:r/~w=1
+        if (runI2c(bus, bus->startFlags | I2C_MCS_START | I2C_MCS_RUN | I2C_MCS_STOP))
+            data[i++] = REG(bus->base, MDR);
+    }
+    else if (size > 1)
+    {
+        // add and first byte of read with ack
+        REG(bus->base, MSA) = (add << 1) | 1; // add:r/~w=1
+        if (!runI2c(bus, bus->startFlags | I2C_MCS_START | I2C_MCS_RUN | I2C_MCS_ACK))
+            return;
+        data[i++] = REG(bus->base, MDR);
+        // read size-2 bytes with ack
+        while (i < size-1)
+        {
+            if (!runI2c(bus, I2C_MCS_RUN | I2C_MCS_ACK))
+                return;
+            data[i++] = REG(bus->base, MDR);
+        }
+        // last byte of read with nack
+        if (runI2c(bus, I2C_MCS_RUN | I2C_MCS_STOP))
+            data[i++] = REG(bus->base, MDR);
+    }
+}
+
+bool pollI2cAddress(I2C_BUS *bus, uint8_t add)
+{
+    if (!beginI2c(bus))
+        return false;
+    REG(bus->base, MSA) = (add << 1) | 1; // add:r/~w=1
+    return runI2c(bus, bus->startFlags | I2C_MCS_START | I2C_MCS_RUN | I2C_MCS_STOP);
+}
+
+// Outcome of the last transfer, polled or interrupt driven
+bool isI2cError(I2C_BUS *bus)
+{
+    return bus->status != I2C_DONE;
+}
+
+I2C_STATUS getI2cStatus(I2C_BUS *bus)
+{
+    return bus->status;
+}
+
+// Free a slave that holds SDA low in the middle of a byte: clock SCL until
+// SDA is released (9 pulses finish any byte plus its ack), then generate a
+// STOP by hand and hand the pins back to the peripheral
+void recoverI2cBus(I2C_BUS *bus)
+{
+    uint8_t i;
+
+    REG(bus->base, MCR) = 0;
+    setPinValue(bus->port, bus->sclPin, 1);
+    selectPinOpenDrainOutput(bus->port, bus->sclPin);
+    selectPinDigitalInput(bus->port, bus->sdaPin);
+    waitMicrosecond(5);
+    for (i = 0; i < 9 && !getPinValue(bus->port, bus->sdaPin); i++)
+    {
+        setPinValue(bus->port, bus->sclPin, 0);
+        waitMicrosecond(5);
+        setPinValue(bus->port, bus->sclPin, 1);
+        waitMicrosecond(5);
+    }
+
+    // STOP: SDA rises while SCL is high
+    setPinValue(bus->port, bus->sclPin, 0);
+    setPinValue(bus->port, bus->sdaPin, 0);
+    selectPinOpenDrainOutput(bus->port, bus->sdaPin);
+    waitMicrosecond(5);
+    setPinValue(bus->port, bus->sclPin, 1);
+    waitMicrosecond(5);
+    setPinValue(bus->port, bus->sdaPin, 1);
+    waitMicrosecond(5);
+
+    // same pin setup as initI2c
+    selectPinPushPullOutput(bus->port, bus->sclPin);
+    setPinAuxFunction(bus->port, bus->sclPin, bus->sclPctl);
+    selectPinOpenDrainOutput(bus->port, bus->sdaPin);
+    setPinAuxFunction(bus->port, bus->sdaPin, bus->sdaPctl);
+    REG(bus->base, MCR) = I2C_MCR_MFE;
+    bus->stats.recoveries++;
+}
+
+// Non-blocking transactions
+// Completion is reported in t->status and through t->callback
+
+static void applyI2cCommand(I2C_BUS *bus, const I2C_FSM_CMD *cmd)
+{
+    // START sends the address byte, RUN one data byte
+    bus->stats.busBytes += ((cmd->mcs & I2C_MCS_START) != 0) + ((cmd->mcs & I2C_MCS_RUN) != 0);
+    if (cmd->flags & I2C_FSM_SET_MSA)
+        REG(bus->base, MSA) = cmd->msa;
+    if (cmd->flags & I2C_FSM_SET_MDR)
+        REG(bus->base, MDR) = cmd->mdr;
+    REG(bus->base, MCS) = cmd->mcs;
+}
+
+// Returns false if a transaction is already in progress
+// A held bus completes the transaction at once with I2C_BUS_BUSY
+bool startI2cTransaction(I2C_BUS *bus, I2C_TRANSACTION *t)
+{
+    I2C_FSM_CMD cmd;
+    if (isI2cFsmBusy(&bus->fsm))
+        return false;
+    bus->stats.transactions++;
+    if (REG(bus->base, MCS) & I2C_MCS_BUSBSY)
+    {
+        t->status = I2C_BUS_BUSY;
+        setI2cStatus(bus, I2C_BUS_BUSY);
+        if (t->callback)
+            t->callback(t);
+        return true;
+    }
+    i2cFsmStart(&bus->fsm, t, &cmd);
+    REG(bus->base, MICR) = I2C_MICR_IC | I2C_MICR_CLKIC;
+    REG(bus->base, MIMR) = I2C_MIMR_IM | I2C_MIMR_CLKIM;
+    applyI2cCommand(bus, &cmd);
+    return true;
+}
+
+bool isI2cBusy(I2C_BUS *bus)
+{
+    return isI2cFsmBusy(&bus->fsm);
+}
+
+// A slave holding SCL low past the clock-low timeout aborts the transaction
+void i2cIsr(I2C_BUS *bus)
+{
+    I2C_FSM_CMD cmd;
+    bool more;
+
+    if (REG(bus->base, MRIS) & I2C_MRIS_CLKRIS)
+    {
+        REG(bus->base, MICR) = I2C_MICR_IC | I2C_MICR_CLKIC;
+        i2cFsmAbort(&bus->fsm, I2C_TIMEOUT);
+        more = false;
+    }
+    else
+    {
+        REG(bus->base, MICR) = I2C_MICR_IC;
+        more = i2cFsmStep(&bus->fsm, REG(bus->base, MCS), REG(bus->base, MDR), &cmd);
+    }
+    if (more)
+        applyI2cCommand(bus, &cmd);
+    else
+    {
+        REG(bus->base, MIMR) = 0;
+        setI2cStatus(bus, bus->fsm.t->status);
+        i2cFsmComplete(&bus->fsm);
+    }
+}
+
+// Vectors for the other masters, I2C0 is in i2c0.c
+void i2c1Isr(void)
+{
+    i2cIsr(&i2cBus[1]);
+}
+
+void i2c2Isr(void)
+{
+    i2cIsr(&i2cBus[2]);
+}
+
+void i2c3Isr(void)
+{
+    i2cIsr(&i2cBus[3]);
+}
+
+// Batches
+// The transactions of a batch run back to back from the interrupt and the
+// batch completes once, on the first failure or after the last transaction
+// The callback and context of each transaction are used by the queue
+
+static bool startI2cBatch(I2C_BUS *bus, I2C_BATCH *b);
+
+// Transaction callback, advances the batch at the head of its bus queue
+static void stepI2cBatch(I2C_TRANSACTION *t)
+{
+    I2C_BATCH *b = t->context;
+    I2C_BUS *bus = b->bus;
+    if (t->status == I2C_DONE && ++b->index < b->count)
+    {
+        startI2cTransaction(bus, &b->t[b->index]);
+        return;
+    }
+
+    // retire this batch and start the next one queued
+    bus->queueHead = (bus->queueHead + 1) % I2C_QUEUE_SIZE;
+    bus->queueCount--;
+    bus->stats.batches++;
+    while (bus->queueCount > 0 && !startI2cBatch(bus, bus->queue[bus->queueHead]))
+    {
+        bus->queueHead = (bus->queueHead + 1) % I2C_QUEUE_SIZE;
+        bus->queueCount--;
+    }
+
+    // notify last so a callback that queues more work finds the queue settled
+    b->status = t->status;
+    if (b->callback)
+        b->callback(b);
+}
+
+// Returns false for an empty batch, which completes immediately
+static bool startI2cBatch(I2C_BUS *bus, I2C_BATCH *b)
+{
+    uint8_t i;
+    b->index = 0;
+    if (b->count == 0)
+    {
+        b->status = I2C_DONE;
+        if (b->callback)
+            b->callback(b);
+        return false;
+    }
+    for (i = 0; i < b->count; i++)
+    {
+        b->t[i].callback = stepI2cBatch;
+        b->t[i].context = b;
+    }
+    startI2cTransaction(bus, &b->t[0]);
+    return true;
+}
+
+// Add a batch to the queue, it starts at once if the bus is idle
+// Returns false if the queue is full, counted as I2C_QUEUE_FULL
+bool queueI2cBatch(I2C_BUS *bus, I2C_BATCH *b)
+{
+    bool ok = true;
+    disableI2cInterrupt(bus);
+    if (bus->queueCount == I2C_QUEUE_SIZE)
+    {
+        bus->stats.errors[I2C_QUEUE_FULL]++;
+        ok = false;
+    }
+    else
+    {
+        b->status = I2C_BUSY;
+        b->bus = bus;
+        bus->queue[(bus->queueHead + bus->queueCount) % I2C_QUEUE_SIZE] = b;
+        bus->queueCount++;
+        if (bus->queueCount > bus->stats.maxQueueDepth)
+            bus->stats.maxQueueDepth = bus->queueCount;
+        if (bus->queueCount == 1 && !startI2cBatch(bus, b))
+            bus->queueCount--;
+    }
+    enableI2cInterrupt(bus);
+    return ok;
+}
+
+// Fail the transaction on the bus and every queued batch, then free the bus
+// Used when the master interrupt never arrives
+static void abortI2cQueue(I2C_BUS *bus, I2C_STATUS status)
+{
+    I2C_BATCH *b;
+
+    disableI2cInterrupt(bus);
+    REG(bus->base, MIMR) = 0;
+    if (isI2cFsmBusy(&bus->fsm))
+    {
+        i2cFsmAbort(&bus->fsm, status);
+        bus->fsm.t = 0;
+    }
+    setI2cStatus(bus, status);
+    while (bus->queueCount > 0)
+    {
+        b = bus->queue[bus->queueHead];
+        bus->queueHead = (bus->queueHead + 1) % I2C_QUEUE_SIZE;
+        bus->queueCount--;
+        b->status = status;
+        if (b->callback)
+            b->callback(b);
+    }
+    recoverI2cBus(bus);
+    enableI2cInterrupt(bus);
+}
+
+// Wait for the batch to complete
+// Every batch queued ahead of it gets I2C_BATCH_TIMEOUT_US, after that the
+// queue is failed with I2C_TIMEOUT and the bus recovered, so a lost interrupt
+// or a stuck slave cannot hang the caller
+I2C_STATUS waitI2cBatch(I2C_BATCH *b)
+{
+    uint32_t limitUs = I2C_BATCH_TIMEOUT_US * (b->bus->queueCount + 1);
+    uint32_t us = 0;
+
+    while (b->status == I2C_BUSY)
+    {
+        if (us >= limitUs)
+        {
+            abortI2cQueue(b->bus, I2C_TIMEOUT);
+            break;
+        }
+        waitMicrosecond(10);
+        us += 10;
+    }
+    return b->status;
+}
+
+// Retry a batch that completed with status, up to retries times with
+// exponential backoff
+// A bus still held after a failure, by a slave stuck in the middle of a byte
+// or a clock timeout, is recovered first; a timed out wait has already
+// recovered it
+// A full queue only waits, its bus is busy with the transfers ahead
+// Otherwise the bus queue must be idle, a recovery would cut into them
+I2C_STATUS retryI2cBatch(I2C_BUS *bus, I2C_BATCH *b, I2C_STATUS status, uint8_t retries)
+{
+    uint32_t backoffUs = I2C_BACKOFF_US;
+
+    while (status != I2C_DONE && retries-- > 0)
+    {
+        bus->stats.retries++;
+        if (status != I2C_QUEUE_FULL && (REG(bus->base, MCS) & I2C_MCS_BUSBSY))
+            recoverI2cBus(bus);
+        waitMicrosecond(backoffUs);
+        backoffUs *= 2;
+        if (queueI2cBatch(bus, b))
+            status = waitI2cBatch(b);
+        else
+            status = I2C_QUEUE_FULL;
+    }
+    return status;
+}
+
+// Run a batch to completion, retrying failures
+I2C_STATUS runI2cBatch(I2C_BUS *bus, I2C_BATCH *b, uint8_t retries)
+{
+    I2C_STATUS status = I2C_QUEUE_FULL;
+
+    if (queueI2cBatch(bus, b))
+        status = waitI2cBatch(b);
+    return retryI2cBatch(bus, b, status, retries);
+}
+
+uint8_t getI2cQueueDepth(I2C_BUS *bus)
+{
+    return bus->queueCount;
+}
+
+void getI2cStats(I2C_BUS *bus, I2C_STATS *stats)
+{
+    *stats = bus->stats;
+}
+
+void resetI2cStats(I2C_BUS *bus)
+{
+    uint8_t i;
+    bus->stats.transactions = 0;
+    bus->stats.batches = 0;
+    bus->stats.busBytes = 0;
+    bus->stats.maxQueueDepth = bus->queueCount;
+    bus->stats.retries = 0;
+    bus->stats.recoveries = 0;
+    for (i = 0; i < I2C_STATUS_COUNT; i++)
+        bus->stats.errors[i] = 0;
+}
+
+// Bus utilization in 0.01% over the time since the stats were reset
+// Only transactions started through the queue or startI2cTransaction count
+uint16_t getI2cUtilization(I2C_BUS *bus, uint32_t elapsedUs)
+{
+    uint64_t busyNs = (uint64_t)bus->stats.busBytes * bus->byteNs;
+    uint64_t u;
+    if (elapsedUs == 0)
+        return 0;
+    u = busyNs * 10 / elapsedUs;                        // ns * 10000 / (us * 1000)
+    return u > 10000 ? 10000 : u;
+}
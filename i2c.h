@@ -0,0 +1,133 @@
+// I2C Library
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    40 MHz
+
+// Hardware configuration:
+// I2C0 on PB2 (SCL) / PB3 (SDA)
+// I2C1 on PA6 (SCL) / PA7 (SDA)
+// I2C2 on PE4 (SCL) / PE5 (SDA)
+// I2C3 on PD0 (SCL) / PD1 (SDA)
+// 2kohm pullups on SDA and SCL of each bus in use
+
+//-----------------------------------------------------------------------------
+// Device includes, defines, and assembler directives
+//-----------------------------------------------------------------------------
+
+#ifndef I2C_H_
+#define I2C_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "gpio.h"
+#include "i2c_fsm.h"
+
+#define I2C_BUS_COUNT   4
+#define I2C_QUEUE_SIZE  8
+
+// Failure handling
+#define I2C_TIMEOUT_US  2000                            // polled wait per command
+#define I2C_BATCH_TIMEOUT_US 5000                       // queued wait per batch
+#define I2C_RETRIES     3
+#define I2C_BACKOFF_US  100                             // doubled after each retry
+
+// Bus speeds
+// Per ADS1115 sample (5 byte read + 4 byte write, about 85 SCL periods):
+// 100 kHz 850 us, 400 kHz 213 us, 1 MHz 85 us, 3.33 MHz 26 us plus master code
+#define I2C_STANDARD_HZ 100000
+#define I2C_FAST_HZ     400000
+#define I2C_FM_PLUS_HZ  1000000
+#define I2C_HS_HZ       3400000                         // high-speed, 3.33 MHz at 40 MHz
+
+// Transactions run back to back with a single completion
+typedef struct _I2C_BATCH
+{
+    I2C_TRANSACTION *t;
+    uint8_t count;
+    uint8_t index;
+    void (*callback)(struct _I2C_BATCH *b);
+    void *context;
+    volatile I2C_STATUS status;
+    struct _I2C_BUS *bus;                               // set when queued
+} I2C_BATCH;
+
+typedef struct _I2C_STATS
+{
+    uint32_t transactions;
+    uint32_t batches;
+    uint32_t busBytes;                                  // address and data bytes clocked
+    uint8_t maxQueueDepth;
+    uint32_t errors[I2C_STATUS_COUNT];                  // failures by status
+    uint32_t retries;
+    uint32_t recoveries;
+} I2C_STATS;
+
+// One I2C master: fixed hardware description, then driver state
+typedef struct _I2C_BUS
+{
+    uint32_t base;                                      // master registers
+    uint8_t irq;                                        // INT_I2Cn
+    uint8_t rcgc;                                       // SYSCTL_RCGCI2C bit
+    PORT port;
+    uint8_t sclPin;
+    uint8_t sdaPin;
+    uint32_t sclPctl;
+    uint32_t sdaPctl;
+
+    I2C_FSM fsm;
+    I2C_BATCH *queue[I2C_QUEUE_SIZE];                   // head is the batch on the bus
+    uint8_t queueHead;
+    uint8_t queueCount;
+    I2C_STATS stats;
+    volatile I2C_STATUS status;                         // outcome of the last transfer
+    uint8_t startFlags;                                 // added to every START, selects high-speed mode
+    uint32_t byteNs;                                    // SCL time per byte (8 data bits + ack)
+    uint32_t timeoutLoops;
+} I2C_BUS;
+
+extern I2C_BUS i2cBus[I2C_BUS_COUNT];
+
+//-----------------------------------------------------------------------------
+// Subroutines
+//-----------------------------------------------------------------------------
+
+uint32_t initI2c(I2C_BUS *bus, uint32_t sysclk, uint32_t sclHz);
+
+// Polled transfers
+void writeI2cData(I2C_BUS *bus, uint8_t add, uint8_t data);
+uint8_t readI2cData(I2C_BUS *bus, uint8_t add);
+void writeI2cRegister(I2C_BUS *bus, uint8_t add, uint8_t reg, uint8_t data);
+void writeI2cRegisters(I2C_BUS *bus, uint8_t add, uint8_t reg, const uint8_t data[], uint8_t size);
+uint8_t readI2cRegister(I2C_BUS *bus, uint8_t add, uint8_t reg);
+void readI2cRegisters(I2C_BUS *bus, uint8_t add, uint8_t reg, uint8_t data[], uint8_t size);
+bool pollI2cAddress(I2C_BUS *bus, uint8_t add);
+
+// General functions
+bool isI2cError(I2C_BUS *bus);
+I2C_STATUS getI2cStatus(I2C_BUS *bus);
+void recoverI2cBus(I2C_BUS *bus);
+
+// Non-blocking transactions, completed from the bus interrupt
+bool startI2cTransaction(I2C_BUS *bus, I2C_TRANSACTION *t);
+bool isI2cBusy(I2C_BUS *bus);
+void i2cIsr(I2C_BUS *bus);
+void i2c1Isr(void);
+void i2c2Isr(void);
+void i2c3Isr(void);
+
+// Transaction queue
+bool queueI2cBatch(I2C_BUS *bus, I2C_BATCH *b);
+I2C_STATUS waitI2cBatch(I2C_BATCH *b);
+I2C_STATUS retryI2cBatch(I2C_BUS *bus, I2C_BATCH *b, I2C_STATUS status, uint8_t retries);
+I2C_STATUS runI2cBatch(I2C_BUS *bus, I2C_BATCH *b, uint8_t retries);
+uint8_t getI2cQueueDepth(I2C_BUS *bus);
+void getI2cStats(I2C_BUS *bus, I2C_STATS *stats);
+void resetI2cStats(I2C_BUS *bus);
+uint16_t getI2cUtilization(I2C_BUS *bus, uint32_t elapsedUs);
+
+#endif
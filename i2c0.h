@@ -21,12 +21,16 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include "i2c.h"
+
+// Bus 0 of the multi-bus driver in i2c.c
+#define I2C0_BUS (&i2cBus[0])
 
 //-----------------------------------------------------------------------------
 // Subroutines
 //-----------------------------------------------------------------------------
 
-void initI2c0(void);
+uint32_t initI2c0(uint32_t sysclk, uint32_t sclHz);
 // For simple devices with a single internal register
 void writeI2c0Data(uint8_t add, uint8_t data);
 uint8_t readI2c0Data(uint8_t add);
@@ -40,6 +44,20 @@ void readI2c0Registers(uint8_t add, uint8_t reg, uint8_t data[], uint8_t size);
 // General functions
 bool pollI2c0Address(uint8_t add);
 bool isI2c0Error(void);
+I2C_STATUS getI2c0Status(void);
+void recoverI2c0Bus(void);
+
+// Non-blocking transactions, completed from the I2C0 interrupt
+bool startI2c0Transaction(I2C_TRANSACTION *t);
+bool isI2c0Busy(void);
+void i2c0Isr(void);
+
+// Transaction queue
+bool queueI2c0Batch(I2C_BATCH *b);
+I2C_STATUS runI2c0Batch(I2C_BATCH *b, uint8_t retries);
+uint8_t getI2c0QueueDepth(void);
+void getI2c0Stats(I2C_STATS *stats);
+void resetI2c0Stats(void);
+uint16_t getI2c0Utilization(uint32_t elapsedUs);
 
 #endif
-
@@ -0,0 +1,166 @@
+// I2C Master State Machine Library
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    40 MHz
+
+// Hardware configuration:
+// None, no register access so the sequencing can be run against a
+// simulated peripheral on a host
+
+//-----------------------------------------------------------------------------
+// Device includes, defines, and assembler directives
+//-----------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "i2c_fsm.h"
+
+// Phases
+#define PHASE_WRITE 0
+#define PHASE_READ  1
+#define PHASE_STOP  2
+
+//-----------------------------------------------------------------------------
+// Subroutines
+//-----------------------------------------------------------------------------
+
+// First byte of the read phase, with a repeated start after writes
+static void startRead(I2C_FSM *fsm, I2C_FSM_CMD *cmd)
+{
+    I2C_TRANSACTION *t = fsm->t;
+    fsm->phase = PHASE_READ;
+    fsm->index = 0;
+    cmd->flags = I2C_FSM_SET_MSA;
+    cmd->msa = (t->add << 1) | 1;                       // add:r/~w=1
+    cmd->mcs = fsm->startFlags | I2C_FSM_START | I2C_FSM_RUN | (t->readSize > 1 ? I2C_FSM_ACK : I2C_FSM_STOP);
+}
+
+// Begin a transaction, cmd is the first peripheral access
+void i2cFsmStart(I2C_FSM *fsm, I2C_TRANSACTION *t, I2C_FSM_CMD *cmd)
+{
+    fsm->t = t;
+    fsm->error = I2C_DONE;
+    t->status = I2C_BUSY;
+    if (t->writeSize > 0)
+    {
+        fsm->phase = PHASE_WRITE;
+        fsm->index = 1;
+        cmd->flags = I2C_FSM_SET_MSA | I2C_FSM_SET_MDR;
+        cmd->msa = t->add << 1;                         // add:r/~w=0
+        cmd->mdr = t->writeData[0];
+        cmd->mcs = fsm->startFlags | I2C_FSM_START | I2C_FSM_RUN;
+        if (t->writeSize == 1 && t->readSize == 0)
+            cmd->mcs |= I2C_FSM_STOP;
+    }
+    else if (t->readSize > 0)
+        startRead(fsm, cmd);
+    else
+    {
+        // address poll
+        fsm->phase = PHASE_STOP;
+        cmd->flags = I2C_FSM_SET_MSA;
+        cmd->msa = (t->add << 1) | 1;
+        cmd->mcs = fsm->startFlags | I2C_FSM_START | I2C_FSM_RUN | I2C_FSM_STOP;
+    }
+}
+
+// Advance after a master interrupt
+// mcs is the I2CMCS status and mdr the received byte
+// Returns true with the next access in cmd, or false once t->status is final
+bool i2cFsmStep(I2C_FSM *fsm, uint8_t mcs, uint8_t mdr, I2C_FSM_CMD *cmd)
+{
+    I2C_TRANSACTION *t = fsm->t;
+    I2C_STATUS error;
+    bool stopSent;
+
+    if (fsm->phase == PHASE_STOP)
+    {
+        if (fsm->error != I2C_DONE)
+            t->status = fsm->error;
+        else
+            t->status = (mcs & I2C_FSM_ERROR) ? I2C_ADDR_NACK : I2C_DONE;
+        return false;
+    }
+
+    if (mcs & I2C_FSM_ERROR)
+    {
+        if (mcs & I2C_FSM_ARBLST)
+        {
+            // bus already released by the winning master
+            t->status = I2C_ARB_LOST;
+            return false;
+        }
+        // a nack ends the transfer, but STOP must still be sent unless it was
+        stopSent = (fsm->phase == PHASE_WRITE && fsm->index == t->writeSize && t->readSize == 0)
+                || (fsm->phase == PHASE_READ && fsm->index == t->readSize - 1);
+        error = (mcs & I2C_FSM_ADRACK) ? I2C_ADDR_NACK : I2C_DATA_NACK;
+        if (stopSent)
+        {
+            t->status = error;
+            return false;
+        }
+        fsm->phase = PHASE_STOP;
+        fsm->error = error;
+        cmd->flags = 0;
+        cmd->mcs = I2C_FSM_STOP;
+        return true;
+    }
+
+    if (fsm->phase == PHASE_WRITE)
+    {
+        if (fsm->index < t->writeSize)
+        {
+            cmd->flags = I2C_FSM_SET_MDR;
+            cmd->mdr = t->writeData[fsm->index++];
+            cmd->mcs = I2C_FSM_RUN;
+            if (fsm->index == t->writeSize && t->readSize == 0)
+                cmd->mcs |= I2C_FSM_STOP;
+            return true;
+        }
+        if (t->readSize > 0)
+        {
+            startRead(fsm, cmd);
+            return true;
+        }
+        t->status = I2C_DONE;
+        return false;
+    }
+
+    // read phase, last byte was sent with STOP
+    t->readData[fsm->index++] = mdr;
+    if (fsm->index == t->readSize)
+    {
+        t->status = I2C_DONE;
+        return false;
+    }
+    cmd->flags = 0;
+    cmd->mcs = I2C_FSM_RUN | (fsm->index == t->readSize - 1 ? I2C_FSM_STOP : I2C_FSM_ACK);
+    return true;
+}
+
+// End the transaction without further bus access, e.g. on a clock timeout
+void i2cFsmAbort(I2C_FSM *fsm, I2C_STATUS status)
+{
+    fsm->t->status = status;
+}
+
+// Release the machine and notify the owner
+// The callback may start the next transaction
+void i2cFsmComplete(I2C_FSM *fsm)
+{
+    I2C_TRANSACTION *t = fsm->t;
+    fsm->t = NULL;
+    if (t->callback)
+        t->callback(t);
+}
+
+bool isI2cFsmBusy(const I2C_FSM *fsm)
+{
+    return fsm->t != NULL;
+}
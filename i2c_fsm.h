@@ -0,0 +1,94 @@
+// I2C Master State Machine Library
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    40 MHz
+
+// Hardware configuration:
+// None, the state machine only produces I2CMCS/I2CMSA/I2CMDR values
+// The peripheral driver (i2c0.c) applies them from its interrupt handler
+
+//-----------------------------------------------------------------------------
+// Device includes, defines, and assembler directives
+//-----------------------------------------------------------------------------
+
+#ifndef I2C_FSM_H_
+#define I2C_FSM_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// I2CMCS command bits (write)
+#define I2C_FSM_RUN     0x01
+#define I2C_FSM_START   0x02
+#define I2C_FSM_STOP    0x04
+#define I2C_FSM_ACK     0x08
+#define I2C_FSM_HS      0x10
+
+// I2CMCS status bits (read)
+#define I2C_FSM_ERROR   0x02
+#define I2C_FSM_ADRACK  0x04
+#define I2C_FSM_DATACK  0x08
+#define I2C_FSM_ARBLST  0x10
+
+// Command flags
+#define I2C_FSM_SET_MSA 0x01
+#define I2C_FSM_SET_MDR 0x02
+
+typedef enum _I2C_STATUS
+{
+    I2C_IDLE, I2C_BUSY, I2C_DONE,
+    I2C_ADDR_NACK, I2C_DATA_NACK, I2C_ARB_LOST, I2C_TIMEOUT, I2C_BUS_BUSY,
+    I2C_QUEUE_FULL,                                     // batch not queued, never on the bus
+    I2C_STATUS_COUNT
+} I2C_STATUS;
+
+// Transaction descriptor
+// Writes writeSize bytes, then a repeated start reads readSize bytes
+// With both sizes zero the address is only polled for an ack
+// The callback runs in interrupt context once status is final
+typedef struct _I2C_TRANSACTION
+{
+    uint8_t add;
+    const uint8_t *writeData;
+    uint8_t writeSize;
+    uint8_t *readData;
+    uint8_t readSize;
+    void (*callback)(struct _I2C_TRANSACTION *t);
+    void *context;
+    volatile I2C_STATUS status;
+} I2C_TRANSACTION;
+
+// Next peripheral access
+typedef struct _I2C_FSM_CMD
+{
+    uint8_t flags;
+    uint8_t msa;
+    uint8_t mdr;
+    uint8_t mcs;
+} I2C_FSM_CMD;
+
+typedef struct _I2C_FSM
+{
+    I2C_TRANSACTION *t;
+    uint8_t index;                                      // next byte in the current phase
+    uint8_t phase;
+    I2C_STATUS error;                                   // held while a STOP is sent after an error
+    uint8_t startFlags;                                 // added to every START (I2C_FSM_HS)
+} I2C_FSM;
+
+//-----------------------------------------------------------------------------
+// Subroutines
+//-----------------------------------------------------------------------------
+
+void i2cFsmStart(I2C_FSM *fsm, I2C_TRANSACTION *t, I2C_FSM_CMD *cmd);
+bool i2cFsmStep(I2C_FSM *fsm, uint8_t mcs, uint8_t mdr, I2C_FSM_CMD *cmd);
+void i2cFsmAbort(I2C_FSM *fsm, I2C_STATUS status);
+void i2cFsmComplete(I2C_FSM *fsm);
+bool isI2cFsmBusy(const I2C_FSM *fsm);
+
+#endif
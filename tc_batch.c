@@ -0,0 +1,86 @@
+// Batch Conversion Library
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC (offline reprocessing of logged ADS1115 counts)
+// Target uC:       -
+// System Clock:    -
+
+// Build with -O3 and -mavx2 (or -march=native) so the sample loop is
+// auto-vectorized, the table reads becoming gathers from typekUv and the
+// slope tables
+
+//-----------------------------------------------------------------------------
+// Device includes, defines, and assembler directives
+//-----------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <stddef.h>
+#include "tc_batch.h"
+#include "typek.h"
+
+// One binary search step, written out in full so the search has no inner loop
+// The step is taken by arithmetic rather than a select so that no branch
+// survives into the vectorizer
+#define TC_BATCH_SEARCH(stride)                                         \
+    j = i + (stride);                                                   \
+    j = j > TYPEK_SEGMENT_COUNT - 1 ? TYPEK_SEGMENT_COUNT - 1 : j;      \
+    i += (j - i) * (typekUv[j] <= uv);
+
+//-----------------------------------------------------------------------------
+// Subroutines
+//-----------------------------------------------------------------------------
+
+// Every sample runs the same instruction sequence: a fixed number of search
+// steps and no data dependent branches, so the compiler can process a full
+// vector of samples at once
+void convert_batch(const int16_t* restrict raw_tc, const int16_t* restrict raw_cjc, float* restrict out, size_t n)
+{
+    size_t k;
+
+    for (k = 0; k < n; k++)
+    {
+        float cjcC, offset, uv, t;
+        int32_t i, j;
+        int32_t valid;
+
+        // TMP36 at 62.5 uV per count, 750 mV at 25 C and 10 mV / deg C
+        cjcC = (raw_cjc[k] * 62.5f - 750000.0f) * 0.0001f + 25.0f;
+
+        // Cold junction voltage from the uniformly spaced breakpoints
+        // Clamps are on the integer index, float selects would stop vectorization
+        offset = cjcC - TYPEK_T_MIN;
+        i = (int32_t)(offset * (1.0f / TYPEK_STEP));
+        i = i < 0 ? 0 : i;
+        i = i > TYPEK_SEGMENT_COUNT - 1 ? TYPEK_SEGMENT_COUNT - 1 : i;
+        uv = typekUv[i] + typekSlope[i] * (offset - i * TYPEK_STEP) * (100 / 65536.0f);
+
+        // Add the thermocouple at 7.8125 uV per count
+        uv += raw_tc[k] * 7.8125f;
+
+        // Binary search for the last breakpoint at or below uv
+        i = 0;
+#if TYPEK_SEGMENT_COUNT > 1024
+        TC_BATCH_SEARCH(1024)
+        TC_BATCH_SEARCH(512)
+#endif
+#if TYPEK_SEGMENT_COUNT > 256
+        TC_BATCH_SEARCH(256)
+#endif
+        TC_BATCH_SEARCH(128)
+        TC_BATCH_SEARCH(64)
+        TC_BATCH_SEARCH(32)
+        TC_BATCH_SEARCH(16)
+        TC_BATCH_SEARCH(8)
+        TC_BATCH_SEARCH(4)
+        TC_BATCH_SEARCH(2)
+        TC_BATCH_SEARCH(1)
+
+        t = TYPEK_T_MIN + i * TYPEK_STEP + (uv - typekUv[i]) * typekInverseSlope[i] * (0.01f / 65536);
+
+        valid = (cjcC >= TYPEK_T_MIN) & (cjcC <= TYPEK_T_MAX) & (uv >= TYPEK_UV_MIN) & (uv <= TYPEK_UV_MAX);
+        out[k] = t * valid;
+    }
+}
@@ -0,0 +1,31 @@
+// Batch Conversion Library
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC (offline reprocessing of logged ADS1115 counts)
+// Target uC:       -
+// System Clock:    -
+
+//-----------------------------------------------------------------------------
+// Device includes, defines, and assembler directives
+//-----------------------------------------------------------------------------
+
+#ifndef TC_BATCH_H_
+#define TC_BATCH_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+//-----------------------------------------------------------------------------
+// Subroutines
+//-----------------------------------------------------------------------------
+
+// Convert n logged sample pairs to type K hot junction temperatures (deg C)
+// raw_tc:  thermocouple counts, AIN2-AIN3 at PGA +/-0.256 V
+// raw_cjc: TMP36 counts, AIN0 at PGA +/-2.048 V
+// Out of range samples convert to 0, as with the firmware
+void convert_batch(const int16_t* raw_tc, const int16_t* raw_cjc, float* out, size_t n);
+
+#endif
@@ -0,0 +1,203 @@
+// Thermocouple Channel Library
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    40 MHz
+
+// Hardware configuration:
+// Up to 4 ADS1115s at 0x48-0x4B on each of I2C0-I2C3
+// Thermocouples on differential inputs, TMP36 cold junction sensor single-ended
+// ALERT/RDY of every ADS1115 wired together on PB5
+
+//-----------------------------------------------------------------------------
+// Device includes, defines, and assembler directives
+//-----------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "i2c.h"
+#include "ads1115.h"
+#include "thermocouple.h"
+#include "tc_channels.h"
+
+// Bus bytes per sample, a config write and a conversion read with address
+// and pointer bytes
+#define SAMPLE_BUS_BYTES 9
+
+//-----------------------------------------------------------------------------
+// Global variables
+//-----------------------------------------------------------------------------
+
+const TC_CHANNEL *channelMap;
+uint8_t channelCount = 0;
+
+// Per-channel acquisition settings and the device each channel is on
+ADS1115_CHANNEL channelSettings[TC_CHANNEL_MAX];
+uint8_t channelDevice[TC_CHANNEL_MAX];
+
+ADS1115 devices[TC_DEVICE_MAX];
+uint8_t deviceCount = 0;
+
+// Last cold junction reading, used while the CJC is left out of a scan
+int32_t cjcCentiC = 2500;
+
+//-----------------------------------------------------------------------------
+// Subroutines
+//-----------------------------------------------------------------------------
+
+// TMP36 output (uV) to temperature (0.01 C)
+// 750 mV at 25 C and 10 mV / deg C, so 100 uV per 0.01 C, rounded
+int32_t tmp36UvToCentiC(int32_t uv)
+{
+    uv -= 750000;
+    return (uv >= 0 ? uv + 50 : uv - 50) / 100 + 2500;
+}
+
+// Build the device list from the map and put every device in a known state,
+// with ALERT/RDY signalling the end of the conversions of a scan
+// Returns false if the map needs more than TC_DEVICE_MAX devices
+bool initTcChannels(const TC_CHANNEL map[], uint8_t count, ADS1115_DR dr)
+{
+    uint8_t i, d;
+
+    if (count > TC_CHANNEL_MAX)
+        count = TC_CHANNEL_MAX;
+    channelMap = map;
+    channelCount = count;
+    deviceCount = 0;
+    for (i = 0; i < count; i++)
+    {
+        for (d = 0; d < deviceCount && (devices[d].bus != map[i].bus || devices[d].add != map[i].add); d++);
+        if (d == deviceCount)
+        {
+            if (deviceCount == TC_DEVICE_MAX)
+                return false;
+            initAds1115(&devices[deviceCount], map[i].bus, map[i].add);
+            enableAds1115ReadyInterrupt(&devices[deviceCount++]);
+        }
+        channelDevice[i] = d;
+        channelSettings[i].mux = map[i].mux;
+        channelSettings[i].pga = map[i].pga;
+        channelSettings[i].dr = dr;
+        channelSettings[i].discard = 0;
+    }
+    return true;
+}
+
+// Data rate of every channel, faster rates trade noise for scan time
+void setTcChannelDataRate(ADS1115_DR dr)
+{
+    uint8_t i;
+    for (i = 0; i < channelCount; i++)
+        channelSettings[i].dr = dr;
+}
+
+// Map entries of the cold junction sensor
+uint16_t getTcCjcMask(void)
+{
+    uint16_t mask = 0;
+    uint8_t i;
+
+    for (i = 0; i < channelCount; i++)
+        if (channelMap[i].type == TC_CJC)
+            mask |= 1 << i;
+    return mask;
+}
+
+// Estimated time for one scanTcChannels pass over mask at data rate dr
+// One round per channel of the busiest device, each round waits one
+// conversion and clocks a config write and a result read per device
+// The buses run concurrently, so a round costs the busiest bus
+uint32_t getTcScanUs(uint16_t mask, ADS1115_DR dr)
+{
+    uint8_t perDevice[TC_DEVICE_MAX] = { 0 };
+    uint32_t busUs[I2C_BUS_COUNT];
+    uint32_t roundUs;
+    uint8_t rounds = 0;
+    uint8_t round, i, d, b;
+    uint32_t us = 0;
+
+    for (i = 0; i < channelCount; i++)
+        if (mask & (1 << i))
+            perDevice[channelDevice[i]]++;
+    for (d = 0; d < deviceCount; d++)
+        if (perDevice[d] > rounds)
+            rounds = perDevice[d];
+    for (round = 0; round < rounds; round++)
+    {
+        for (b = 0; b < I2C_BUS_COUNT; b++)
+            busUs[b] = 0;
+        for (d = 0; d < deviceCount; d++)
+            if (perDevice[d] > round)
+                busUs[devices[d].bus - i2cBus] += SAMPLE_BUS_BYTES * devices[d].bus->byteNs / 1000;
+        roundUs = 0;
+        for (b = 0; b < I2C_BUS_COUNT; b++)
+            if (busUs[b] > roundUs)
+                roundUs = busUs[b];
+        us += getAds1115ConversionUs(dr) + roundUs;
+    }
+    return us;
+}
+
+// Sample the channels in mask (bit n for map entry n) once
+// Each round starts one conversion on every device that still has a channel
+// to do, round robin through its channels, so conversion time overlaps
+// across devices and a pass takes as many rounds as the busiest device has
+// channels
+// Every bus has its own queue and interrupt, so the transfers of a round
+// run on all buses at once and only devices sharing a bus are serialized
+// centiC[] gets 0.01 C and raw[] the ADC counts per sampled map entry,
+// the other entries are left alone
+// Thermocouples use the last cold junction reading when the CJC is not in
+// mask, it changes slowly so it can be refreshed at a lower rate
+// Returns false if any transfer failed
+bool scanTcChannels(int32_t centiC[], int16_t raw[], uint16_t mask)
+{
+    ADS1115 *scanDevice[TC_DEVICE_MAX];
+    const ADS1115_CHANNEL *scanChannel[TC_DEVICE_MAX];
+    uint8_t scanIndex[TC_DEVICE_MAX];
+    int16_t counts[TC_DEVICE_MAX];
+    int32_t uv[TC_CHANNEL_MAX];
+    uint8_t next[TC_DEVICE_MAX];
+    uint8_t count, i, d;
+    bool ok = true;
+
+    for (d = 0; d < deviceCount; d++)
+        next[d] = 0;
+    do
+    {
+        // next unsampled channel of each device
+        count = 0;
+        for (d = 0; d < deviceCount; d++)
+        {
+            for (i = next[d]; i < channelCount && (channelDevice[i] != d || !(mask & (1 << i))); i++);
+            next[d] = i + 1;
+            if (i < channelCount)
+            {
+                scanDevice[count] = &devices[d];
+                scanChannel[count] = &channelSettings[i];
+                scanIndex[count++] = i;
+            }
+        }
+        if (count > 0)
+            ok &= scanAds1115(scanDevice, scanChannel, counts, count);
+        for (i = 0; i < count; i++)
+        {
+            raw[scanIndex[i]] = counts[i];
+            uv[scanIndex[i]] = ads1115RawToUv(counts[i], scanChannel[i]->pga);
+        }
+    } while (count > 0);
+
+    // cold junction first, the thermocouples are referred to it
+    for (i = 0; i < channelCount; i++)
+        if (channelMap[i].type == TC_CJC && (mask & (1 << i)))
+            centiC[i] = cjcCentiC = tmp36UvToCentiC(uv[i]);
+    for (i = 0; i < channelCount; i++)
+        if (channelMap[i].type != TC_CJC && (mask & (1 << i)))
+            centiC[i] = tc_convert_uv((TC_TYPE)channelMap[i].type, uv[i], cjcCentiC);
+    return ok;
+}
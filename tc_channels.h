@@ -0,0 +1,56 @@
+// Thermocouple Channel Library
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    40 MHz
+
+// Hardware configuration:
+// Up to 4 ADS1115s at 0x48-0x4B on each of I2C0-I2C3
+// Thermocouples on differential inputs, TMP36 cold junction sensor single-ended
+// ALERT/RDY of every ADS1115 wired together on PB5
+
+//-----------------------------------------------------------------------------
+// Device includes, defines, and assembler directives
+//-----------------------------------------------------------------------------
+
+#ifndef TC_CHANNELS_H_
+#define TC_CHANNELS_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "i2c.h"
+#include "ads1115.h"
+#include "thermocouple.h"
+
+#define TC_CHANNEL_MAX 16
+#define TC_DEVICE_MAX  ADS1115_SCAN_MAX
+
+// Channel type for the TMP36 cold junction sensor
+#define TC_CJC         TC_TYPE_COUNT
+
+// Channel map entry, a device is the address on a bus
+typedef struct _TC_CHANNEL
+{
+    I2C_BUS *bus;                                       // initialized by the caller
+    uint8_t add;                                        // ADS1115 address
+    ADS1115_MUX mux;
+    ADS1115_PGA pga;
+    uint8_t type;                                       // TC_TYPE or TC_CJC
+} TC_CHANNEL;
+
+//-----------------------------------------------------------------------------
+// Subroutines
+//-----------------------------------------------------------------------------
+
+bool initTcChannels(const TC_CHANNEL map[], uint8_t count, ADS1115_DR dr);
+void setTcChannelDataRate(ADS1115_DR dr);
+uint16_t getTcCjcMask(void);
+uint32_t getTcScanUs(uint16_t mask, ADS1115_DR dr);
+bool scanTcChannels(int32_t centiC[], int16_t raw[], uint16_t mask);
+int32_t tmp36UvToCentiC(int32_t uv);
+
+#endif
@@ -0,0 +1,204 @@
+// Thermocouple Reference Tables
+// NIST ITS-90, thermoelectric voltage in uV every 10 C plus the end of each range
+
+// Each TC_NIST_x(X) expands X(t, uv) once per breakpoint in rising order
+// Type K has its own 1 C list in typek_nist.h
+
+// Type B: Platinum-30% rhodium / platinum-6% rhodium, 0 to 1820 C
+#define TC_NIST_B(X) \
+    X(0, 0) X(10, -2) X(20, -3) X(30, -2) X(40, 0) X(50, 2) \
+    X(60, 6) X(70, 11) X(80, 17) X(90, 25) X(100, 33) X(110, 43) \
+    X(120, 53) X(130, 65) X(140, 78) X(150, 92) X(160, 107) X(170, 123) \
+    X(180, 141) X(190, 159) X(200, 178) X(210, 199) X(220, 220) X(230, 243) \
+    X(240, 267) X(250, 291) X(260, 317) X(270, 344) X(280, 372) X(290, 401) \
+    X(300, 431) X(310, 462) X(320, 494) X(330, 527) X(340, 561) X(350, 596) \
+    X(360, 632) X(370, 669) X(380, 707) X(390, 746) X(400, 787) X(410, 828) \
+    X(420, 870) X(430, 913) X(440, 957) X(450, 1002) X(460, 1048) X(470, 1095) \
+    X(480, 1143) X(490, 1192) X(500, 1242) X(510, 1293) X(520, 1344) X(530, 1397) \
+    X(540, 1451) X(550, 1505) X(560, 1561) X(570, 1617) X(580, 1675) X(590, 1733) \
+    X(600, 1792) X(610, 1852) X(620, 1913) X(630, 1975) X(640, 2037) X(650, 2101) \
+    X(660, 2165) X(670, 2230) X(680, 2296) X(690, 2363) X(700, 2431) X(710, 2499) \
+    X(720, 2569) X(730, 2639) X(740, 2710) X(750, 2782) X(760, 2854) X(770, 2928) \
+    X(780, 3002) X(790, 3078) X(800, 3154) X(810, 3230) X(820, 3308) X(830, 3386) \
+    X(840, 3466) X(850, 3546) X(860, 3626) X(870, 3708) X(880, 3790) X(890, 3873) \
+    X(900, 3957) X(910, 4041) X(920, 4127) X(930, 4213) X(940, 4299) X(950, 4387) \
+    X(960, 4475) X(970, 4564) X(980, 4653) X(990, 4743) X(1000, 4834) X(1010, 4926) \
+    X(1020, 5018) X(1030, 5111) X(1040, 5205) X(1050, 5299) X(1060, 5394) X(1070, 5489) \
+    X(1080, 5585) X(1090, 5682) X(1100, 5780) X(1110, 5878) X(1120, 5976) X(1130, 6075) \
+    X(1140, 6175) X(1150, 6276) X(1160, 6377) X(1170, 6478) X(1180, 6580) X(1190, 6683) \
+    X(1200, 6786) X(1210, 6890) X(1220, 6995) X(1230, 7100) X(1240, 7205) X(1250, 7311) \
+    X(1260, 7417) X(1270, 7524) X(1280, 7632) X(1290, 7740) X(1300, 7848) X(1310, 7957) \
+    X(1320, 8066) X(1330, 8176) X(1340, 8286) X(1350, 8397) X(1360, 8508) X(1370, 8620) \
+    X(1380, 8731) X(1390, 8844) X(1400, 8956) X(1410, 9069) X(1420, 9182) X(1430, 9296) \
+    X(1440, 9410) X(1450, 9524) X(1460, 9639) X(1470, 9753) X(1480, 9868) X(1490, 9984) \
+    X(1500, 10099) X(1510, 10215) X(1520, 10331) X(1530, 10447) X(1540, 10563) X(1550, 10679) \
+    X(1560, 10796) X(1570, 10913) X(1580, 11029) X(1590, 11146) X(1600, 11263) X(1610, 11380) \
+    X(1620, 11497) X(1630, 11614) X(1640, 11731) X(1650, 11848) X(1660, 11965) X(1670, 12082) \
+    X(1680, 12199) X(1690, 12316) X(1700, 12433) X(1710, 12549) X(1720, 12666) X(1730, 12782) \
+    X(1740, 12898) X(1750, 13014) X(1760, 13130) X(1770, 13246) X(1780, 13361) X(1790, 13476) \
+    X(1800, 13591) X(1810, 13706) X(1820, 13820)
+
+// Type E: Nickel-chromium / copper-nickel, -270 to 1000 C
+#define TC_NIST_E(X) \
+    X(-270, -9835) X(-260, -9797) X(-250, -9718) X(-240, -9604) X(-230, -9455) X(-220, -9274) \
+    X(-210, -9063) X(-200, -8825) X(-190, -8561) X(-180, -8273) X(-170, -7963) X(-160, -7632) \
+    X(-150, -7279) X(-140, -6907) X(-130, -6516) X(-120, -6107) X(-110, -5681) X(-100, -5237) \
+    X(-90, -4777) X(-80, -4302) X(-70, -3811) X(-60, -3306) X(-50, -2787) X(-40, -2255) \
+    X(-30, -1709) X(-20, -1152) X(-10, -582) X(0, 0) X(10, 591) X(20, 1192) \
+    X(30, 1801) X(40, 2420) X(50, 3048) X(60, 3685) X(70, 4330) X(80, 4985) \
+    X(90, 5648) X(100, 6319) X(110, 6998) X(120, 7685) X(130, 8379) X(140, 9081) \
+    X(150, 9789) X(160, 10503) X(170, 11224) X(180, 11951) X(190, 12684) X(200, 13421) \
+    X(210, 14164) X(220, 14912) X(230, 15664) X(240, 16420) X(250, 17181) X(260, 17945) \
+    X(270, 18713) X(280, 19484) X(290, 20259) X(300, 21036) X(310, 21817) X(320, 22600) \
+    X(330, 23386) X(340, 24174) X(350, 24964) X(360, 25757) X(370, 26552) X(380, 27348) \
+    X(390, 28146) X(400, 28946) X(410, 29747) X(420, 30550) X(430, 31354) X(440, 32159) \
+    X(450, 32965) X(460, 33772) X(470, 34579) X(480, 35387) X(490, 36196) X(500, 37005) \
+    X(510, 37815) X(520, 38624) X(530, 39434) X(540, 40243) X(550, 41053) X(560, 41862) \
+    X(570, 42671) X(580, 43479) X(590, 44286) X(600, 45093) X(610, 45900) X(620, 46705) \
+    X(630, 47509) X(640, 48313) X(650, 49116) X(660, 49917) X(670, 50718) X(680, 51517) \
+    X(690, 52315) X(700, 53112) X(710, 53908) X(720, 54703) X(730, 55497) X(740, 56289) \
+    X(750, 57080) X(760, 57870) X(770, 58659) X(780, 59446) X(790, 60232) X(800, 61017) \
+    X(810, 61801) X(820, 62583) X(830, 63364) X(840, 64144) X(850, 64922) X(860, 65698) \
+    X(870, 66473) X(880, 67246) X(890, 68017) X(900, 68787) X(910, 69554) X(920, 70319) \
+    X(930, 71082) X(940, 71844) X(950, 72603) X(960, 73360) X(970, 74115) X(980, 74869) \
+    X(990, 75621) X(1000, 76373)
+
+// Type J: Iron / copper-nickel, -210 to 1200 C
+#define TC_NIST_J(X) \
+    X(-210, -8095) X(-200, -7890) X(-190, -7659) X(-180, -7403) X(-170, -7123) X(-160, -6821) \
+    X(-150, -6500) X(-140, -6159) X(-130, -5801) X(-120, -5426) X(-110, -5037) X(-100, -4633) \
+    X(-90, -4215) X(-80, -3786) X(-70, -3344) X(-60, -2893) X(-50, -2431) X(-40, -1961) \
+    X(-30, -1482) X(-20, -995) X(-10, -501) X(0, 0) X(10, 507) X(20, 1019) \
+    X(30, 1537) X(40, 2059) X(50, 2585) X(60, 3116) X(70, 3650) X(80, 4187) \
+    X(90, 4726) X(100, 5269) X(110, 5814) X(120, 6360) X(130, 6909) X(140, 7459) \
+    X(150, 8010) X(160, 8562) X(170, 9115) X(180, 9669) X(190, 10224) X(200, 10779) \
+    X(210, 11334) X(220, 11889) X(230, 12445) X(240, 13000) X(250, 13555) X(260, 14110) \
+    X(270, 14665) X(280, 15219) X(290, 15773) X(300, 16327) X(310, 16881) X(320, 17434) \
+    X(330, 17986) X(340, 18538) X(350, 19090) X(360, 19642) X(370, 20194) X(380, 20745) \
+    X(390, 21297) X(400, 21848) X(410, 22400) X(420, 22952) X(430, 23504) X(440, 24057) \
+    X(450, 24610) X(460, 25164) X(470, 25720) X(480, 26276) X(490, 26834) X(500, 27393) \
+    X(510, 27953) X(520, 28516) X(530, 29080) X(540, 29647) X(550, 30216) X(560, 30788) \
+    X(570, 31362) X(580, 31939) X(590, 32519) X(600, 33102) X(610, 33689) X(620, 34279) \
+    X(630, 34873) X(640, 35470) X(650, 36071) X(660, 36675) X(670, 37284) X(680, 37896) \
+    X(690, 38512) X(700, 39132) X(710, 39755) X(720, 40382) X(730, 41012) X(740, 41645) \
+    X(750, 42281) X(760, 42919) X(770, 43559) X(780, 44203) X(790, 44848) X(800, 45494) \
+    X(810, 46141) X(820, 46786) X(830, 47431) X(840, 48074) X(850, 48715) X(860, 49353) \
+    X(870, 49989) X(880, 50622) X(890, 51251) X(900, 51877) X(910, 52500) X(920, 53119) \
+    X(930, 53735) X(940, 54347) X(950, 54956) X(960, 55561) X(970, 56164) X(980, 56763) \
+    X(990, 57360) X(1000, 57953) X(1010, 58545) X(1020, 59134) X(1030, 59721) X(1040, 60307) \
+    X(1050, 60890) X(1060, 61473) X(1070, 62054) X(1080, 62634) X(1090, 63214) X(1100, 63792) \
+    X(1110, 64370) X(1120, 64948) X(1130, 65525) X(1140, 66102) X(1150, 66679) X(1160, 67255) \
+    X(1170, 67831) X(1180, 68406) X(1190, 68980) X(1200, 69553)
+
+// Type N: Nickel-chromium-silicon / nickel-silicon, -270 to 1300 C
+#define TC_NIST_N(X) \
+    X(-270, -4345) X(-260, -4336) X(-250, -4313) X(-240, -4277) X(-230, -4226) X(-220, -4162) \
+    X(-210, -4083) X(-200, -3990) X(-190, -3884) X(-180, -3766) X(-170, -3634) X(-160, -3491) \
+    X(-150, -3336) X(-140, -3171) X(-130, -2994) X(-120, -2808) X(-110, -2612) X(-100, -2407) \
+    X(-90, -2193) X(-80, -1972) X(-70, -1744) X(-60, -1509) X(-50, -1269) X(-40, -1023) \
+    X(-30, -772) X(-20, -518) X(-10, -260) X(0, 0) X(10, 261) X(20, 525) \
+    X(30, 793) X(40, 1065) X(50, 1340) X(60, 1619) X(70, 1902) X(80, 2189) \
+    X(90, 2480) X(100, 2774) X(110, 3072) X(120, 3374) X(130, 3680) X(140, 3989) \
+    X(150, 4302) X(160, 4618) X(170, 4937) X(180, 5259) X(190, 5585) X(200, 5913) \
+    X(210, 6245) X(220, 6579) X(230, 6916) X(240, 7255) X(250, 7597) X(260, 7941) \
+    X(270, 8288) X(280, 8637) X(290, 8988) X(300, 9341) X(310, 9696) X(320, 10054) \
+    X(330, 10413) X(340, 10774) X(350, 11136) X(360, 11501) X(370, 11867) X(380, 12234) \
+    X(390, 12603) X(400, 12974) X(410, 13346) X(420, 13719) X(430, 14094) X(440, 14469) \
+    X(450, 14846) X(460, 15225) X(470, 15604) X(480, 15984) X(490, 16366) X(500, 16748) \
+    X(510, 17131) X(520, 17515) X(530, 17900) X(540, 18286) X(550, 18672) X(560, 19059) \
+    X(570, 19447) X(580, 19835) X(590, 20224) X(600, 20613) X(610, 21003) X(620, 21393) \
+    X(630, 21784) X(640, 22175) X(650, 22566) X(660, 22958) X(670, 23350) X(680, 23742) \
+    X(690, 24134) X(700, 24527) X(710, 24919) X(720, 25312) X(730, 25705) X(740, 26098) \
+    X(750, 26491) X(760, 26883) X(770, 27276) X(780, 27669) X(790, 28062) X(800, 28455) \
+    X(810, 28847) X(820, 29239) X(830, 29632) X(840, 30024) X(850, 30416) X(860, 30807) \
+    X(870, 31199) X(880, 31590) X(890, 31981) X(900, 32371) X(910, 32761) X(920, 33151) \
+    X(930, 33541) X(940, 33930) X(950, 34319) X(960, 34707) X(970, 35095) X(980, 35482) \
+    X(990, 35869) X(1000, 36256) X(1010, 36641) X(1020, 37027) X(1030, 37411) X(1040, 37795) \
+    X(1050, 38179) X(1060, 38562) X(1070, 38944) X(1080, 39326) X(1090, 39706) X(1100, 40087) \
+    X(1110, 40466) X(1120, 40845) X(1130, 41223) X(1140, 41600) X(1150, 41976) X(1160, 42352) \
+    X(1170, 42727) X(1180, 43101) X(1190, 43474) X(1200, 43846) X(1210, 44218) X(1220, 44588) \
+    X(1230, 44958) X(1240, 45326) X(1250, 45694) X(1260, 46060) X(1270, 46425) X(1280, 46789) \
+    X(1290, 47152) X(1300, 47513)
+
+// Type R: Platinum-13% rhodium / platinum, -50 to 1768 C
+#define TC_NIST_R(X) \
+    X(-50, -226) X(-40, -188) X(-30, -145) X(-20, -100) X(-10, -51) X(0, 0) \
+    X(10, 54) X(20, 111) X(30, 171) X(40, 232) X(50, 296) X(60, 363) \
+    X(70, 431) X(80, 501) X(90, 573) X(100, 647) X(110, 723) X(120, 800) \
+    X(130, 879) X(140, 959) X(150, 1041) X(160, 1124) X(170, 1208) X(180, 1294) \
+    X(190, 1381) X(200, 1469) X(210, 1558) X(220, 1648) X(230, 1739) X(240, 1831) \
+    X(250, 1923) X(260, 2017) X(270, 2112) X(280, 2207) X(290, 2304) X(300, 2401) \
+    X(310, 2498) X(320, 2597) X(330, 2696) X(340, 2796) X(350, 2896) X(360, 2997) \
+    X(370, 3099) X(380, 3201) X(390, 3304) X(400, 3408) X(410, 3512) X(420, 3616) \
+    X(430, 3721) X(440, 3827) X(450, 3933) X(460, 4040) X(470, 4147) X(480, 4255) \
+    X(490, 4363) X(500, 4471) X(510, 4580) X(520, 4690) X(530, 4800) X(540, 4910) \
+    X(550, 5021) X(560, 5133) X(570, 5245) X(580, 5357) X(590, 5470) X(600, 5583) \
+    X(610, 5697) X(620, 5812) X(630, 5926) X(640, 6041) X(650, 6157) X(660, 6273) \
+    X(670, 6390) X(680, 6507) X(690, 6625) X(700, 6743) X(710, 6861) X(720, 6980) \
+    X(730, 7100) X(740, 7220) X(750, 7340) X(760, 7461) X(770, 7583) X(780, 7705) \
+    X(790, 7827) X(800, 7950) X(810, 8073) X(820, 8197) X(830, 8321) X(840, 8446) \
+    X(850, 8571) X(860, 8697) X(870, 8823) X(880, 8950) X(890, 9077) X(900, 9205) \
+    X(910, 9333) X(920, 9461) X(930, 9590) X(940, 9720) X(950, 9850) X(960, 9980) \
+    X(970, 10111) X(980, 10242) X(990, 10374) X(1000, 10506) X(1010, 10638) X(1020, 10771) \
+    X(1030, 10905) X(1040, 11039) X(1050, 11173) X(1060, 11307) X(1070, 11442) X(1080, 11578) \
+    X(1090, 11714) X(1100, 11850) X(1110, 11986) X(1120, 12123) X(1130, 12260) X(1140, 12397) \
+    X(1150, 12535) X(1160, 12673) X(1170, 12812) X(1180, 12950) X(1190, 13089) X(1200, 13228) \
+    X(1210, 13367) X(1220, 13507) X(1230, 13646) X(1240, 13786) X(1250, 13926) X(1260, 14066) \
+    X(1270, 14207) X(1280, 14347) X(1290, 14488) X(1300, 14629) X(1310, 14770) X(1320, 14911) \
+    X(1330, 15052) X(1340, 15193) X(1350, 15334) X(1360, 15475) X(1370, 15616) X(1380, 15758) \
+    X(1390, 15899) X(1400, 16040) X(1410, 16181) X(1420, 16323) X(1430, 16464) X(1440, 16605) \
+    X(1450, 16746) X(1460, 16887) X(1470, 17028) X(1480, 17169) X(1490, 17310) X(1500, 17451) \
+    X(1510, 17591) X(1520, 17732) X(1530, 17872) X(1540, 18012) X(1550, 18152) X(1560, 18292) \
+    X(1570, 18431) X(1580, 18571) X(1590, 18710) X(1600, 18849) X(1610, 18988) X(1620, 19126) \
+    X(1630, 19264) X(1640, 19402) X(1650, 19540) X(1660, 19677) X(1670, 19814) X(1680, 19951) \
+    X(1690, 20087) X(1700, 20222) X(1710, 20356) X(1720, 20488) X(1730, 20620) X(1740, 20749) \
+    X(1750, 20877) X(1760, 21003) X(1768, 21101)
+
+// Type S: Platinum-10% rhodium / platinum, -50 to 1768 C
+#define TC_NIST_S(X) \
+    X(-50, -236) X(-40, -194) X(-30, -150) X(-20, -103) X(-10, -53) X(0, 0) \
+    X(10, 55) X(20, 113) X(30, 173) X(40, 235) X(50, 299) X(60, 365) \
+    X(70, 433) X(80, 502) X(90, 573) X(100, 646) X(110, 720) X(120, 795) \
+    X(130, 872) X(140, 950) X(150, 1029) X(160, 1110) X(170, 1191) X(180, 1273) \
+    X(190, 1357) X(200, 1441) X(210, 1526) X(220, 1612) X(230, 1698) X(240, 1786) \
+    X(250, 1874) X(260, 1962) X(270, 2052) X(280, 2141) X(290, 2232) X(300, 2323) \
+    X(310, 2415) X(320, 2507) X(330, 2599) X(340, 2692) X(350, 2786) X(360, 2880) \
+    X(370, 2974) X(380, 3069) X(390, 3164) X(400, 3259) X(410, 3355) X(420, 3451) \
+    X(430, 3548) X(440, 3645) X(450, 3742) X(460, 3840) X(470, 3938) X(480, 4036) \
+    X(490, 4134) X(500, 4233) X(510, 4332) X(520, 4432) X(530, 4532) X(540, 4632) \
+    X(550, 4732) X(560, 4833) X(570, 4934) X(580, 5035) X(590, 5137) X(600, 5239) \
+    X(610, 5341) X(620, 5443) X(630, 5546) X(640, 5649) X(650, 5753) X(660, 5857) \
+    X(670, 5961) X(680, 6065) X(690, 6170) X(700, 6275) X(710, 6381) X(720, 6486) \
+    X(730, 6593) X(740, 6699) X(750, 6806) X(760, 6913) X(770, 7020) X(780, 7128) \
+    X(790, 7236) X(800, 7345) X(810, 7454) X(820, 7563) X(830, 7673) X(840, 7783) \
+    X(850, 7893) X(860, 8003) X(870, 8114) X(880, 8226) X(890, 8337) X(900, 8449) \
+    X(910, 8562) X(920, 8674) X(930, 8787) X(940, 8900) X(950, 9014) X(960, 9128) \
+    X(970, 9242) X(980, 9357) X(990, 9472) X(1000, 9587) X(1010, 9703) X(1020, 9819) \
+    X(1030, 9935) X(1040, 10051) X(1050, 10168) X(1060, 10285) X(1070, 10403) X(1080, 10520) \
+    X(1090, 10638) X(1100, 10757) X(1110, 10875) X(1120, 10994) X(1130, 11113) X(1140, 11232) \
+    X(1150, 11351) X(1160, 11471) X(1170, 11590) X(1180, 11710) X(1190, 11830) X(1200, 11951) \
+    X(1210, 12071) X(1220, 12191) X(1230, 12312) X(1240, 12433) X(1250, 12554) X(1260, 12675) \
+    X(1270, 12796) X(1280, 12917) X(1290, 13038) X(1300, 13159) X(1310, 13280) X(1320, 13402) \
+    X(1330, 13523) X(1340, 13644) X(1350, 13766) X(1360, 13887) X(1370, 14009) X(1380, 14130) \
+    X(1390, 14251) X(1400, 14373) X(1410, 14494) X(1420, 14615) X(1430, 14736) X(1440, 14857) \
+    X(1450, 14978) X(1460, 15099) X(1470, 15220) X(1480, 15341) X(1490, 15461) X(1500, 15582) \
+    X(1510, 15702) X(1520, 15822) X(1530, 15942) X(1540, 16062) X(1550, 16182) X(1560, 16301) \
+    X(1570, 16420) X(1580, 16539) X(1590, 16658) X(1600, 16777) X(1610, 16895) X(1620, 17013) \
+    X(1630, 17131) X(1640, 17249) X(1650, 17366) X(1660, 17483) X(1670, 17600) X(1680, 17717) \
+    X(1690, 17832) X(1700, 17947) X(1710, 18061) X(1720, 18174) X(1730, 18285) X(1740, 18395) \
+    X(1750, 18503) X(1760, 18609) X(1768, 18693)
+
+// Type T: Copper / copper-nickel, -270 to 400 C
+#define TC_NIST_T(X) \
+    X(-270, -6258) X(-260, -6232) X(-250, -6180) X(-240, -6105) X(-230, -6007) X(-220, -5888) \
+    X(-210, -5753) X(-200, -5603) X(-190, -5439) X(-180, -5261) X(-170, -5070) X(-160, -4865) \
+    X(-150, -4648) X(-140, -4419) X(-130, -4177) X(-120, -3923) X(-110, -3657) X(-100, -3379) \
+    X(-90, -3089) X(-80, -2788) X(-70, -2476) X(-60, -2153) X(-50, -1819) X(-40, -1475) \
+    X(-30, -1121) X(-20, -757) X(-10, -383) X(0, 0) X(10, 391) X(20, 790) \
+    X(30, 1196) X(40, 1612) X(50, 2036) X(60, 2468) X(70, 2909) X(80, 3358) \
+    X(90, 3814) X(100, 4279) X(110, 4750) X(120, 5228) X(130, 5714) X(140, 6206) \
+    X(150, 6704) X(160, 7209) X(170, 7720) X(180, 8237) X(190, 8759) X(200, 9288) \
+    X(210, 9822) X(220, 10362) X(230, 10907) X(240, 11458) X(250, 12013) X(260, 12574) \
+    X(270, 13139) X(280, 13709) X(290, 14283) X(300, 14862) X(310, 15445) X(320, 16032) \
+    X(330, 16624) X(340, 17219) X(350, 17819) X(360, 18422) X(370, 19030) X(380, 19641) \
+    X(390, 20255) X(400, 20872)
@@ -0,0 +1,309 @@
+// Telemetry Frame Library
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    40 MHz
+
+// Hardware configuration:
+// None, the encoder and decoder are portable C so a host can decode frames
+// with the same code
+
+//-----------------------------------------------------------------------------
+// Device includes, defines, and assembler directives
+//-----------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "telemetry.h"
+
+#define CENTI_MAX  0x7FFFFF
+#define CENTI_MIN  (-0x800000)
+
+//-----------------------------------------------------------------------------
+// Subroutines
+//-----------------------------------------------------------------------------
+
+// CRC16-CCITT, polynomial 0x1021, initial value 0xFFFF
+uint16_t crc16(const uint8_t data[], uint16_t size)
+{
+    uint16_t crc = 0xFFFF;
+    uint16_t i;
+    uint8_t b;
+
+    for (i = 0; i < size; i++)
+    {
+        crc ^= (uint16_t)data[i] << 8;
+        for (b = 0; b < 8; b++)
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+    return crc;
+}
+
+// COBS, each block starts with the distance to the next zero
+// Returns the encoded size, the delimiter is not added
+static uint16_t cobsEncode(const uint8_t in[], uint16_t size, uint8_t out[])
+{
+    uint16_t code = 0;
+    uint16_t o = 1;
+    uint16_t i;
+    uint8_t run = 1;
+
+    for (i = 0; i < size; i++)
+    {
+        if (in[i] == 0)
+        {
+            out[code] = run;
+            code = o++;
+            run = 1;
+        }
+        else
+        {
+            out[o++] = in[i];
+            if (++run == 0xFF)
+            {
+                out[code] = run;
+                code = o++;
+                run = 1;
+            }
+        }
+    }
+    out[code] = run;
+    return o;
+}
+
+// Returns the decoded size, or 0 for a malformed frame
+static uint16_t cobsDecode(const uint8_t in[], uint16_t size, uint8_t out[], uint16_t outSize)
+{
+    uint16_t i = 0;
+    uint16_t o = 0;
+    uint8_t code, j;
+
+    while (i < size)
+    {
+        code = in[i++];
+        if (code == 0 || i + code - 1 > size || o + code > outSize + 1)
+            return 0;
+        for (j = 1; j < code; j++)
+        {
+            if (in[i] == 0)
+                return 0;
+            out[o++] = in[i++];
+        }
+        if (code < 0xFF && i < size)
+        {
+            if (o == outSize)
+                return 0;
+            out[o++] = 0;
+        }
+    }
+    return o;
+}
+
+static void putLe(uint8_t *p, uint32_t value, uint8_t size)
+{
+    while (size--)
+    {
+        *p++ = value & 0xFF;
+        value >>= 8;
+    }
+}
+
+static uint32_t getLe(const uint8_t *p, uint8_t size)
+{
+    uint32_t value = 0;
+    while (size--)
+        value = (value << 8) | p[size];
+    return value;
+}
+
+static uint8_t putVarint(uint8_t *p, uint32_t value)
+{
+    uint8_t n = 0;
+
+    while (value >= 0x80)
+    {
+        p[n++] = value | 0x80;
+        value >>= 7;
+    }
+    p[n++] = value;
+    return n;
+}
+
+// Returns the bytes used, or 0 if the varint runs past end or 32 bits
+static uint8_t getVarint(const uint8_t *p, const uint8_t *end, uint32_t *value)
+{
+    uint8_t n = 0;
+
+    *value = 0;
+    do
+    {
+        if (p + n == end || n == 5)
+            return 0;
+        *value |= (uint32_t)(p[n] & 0x7F) << (7 * n);
+    } while (p[n++] & 0x80);
+    return n;
+}
+
+static uint32_t zigzag(int32_t value)
+{
+    return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+static int32_t unzigzag(uint32_t value)
+{
+    return (int32_t)(value >> 1) ^ -(int32_t)(value & 1);
+}
+
+static int32_t clampCenti(int32_t centiC)
+{
+    return centiC > CENTI_MAX ? CENTI_MAX : centiC < CENTI_MIN ? CENTI_MIN : centiC;
+}
+
+// Start an empty frame for scans of the channels in channelMask
+void startTelemetry(TELEMETRY_ENCODER *e, uint16_t sequence, uint16_t channelMask, uint16_t cjcMask)
+{
+    uint8_t i;
+
+    e->raw[0] = TELEMETRY_VERSION;
+    putLe(e->raw + 1, sequence, 2);
+    putLe(e->raw + 3, channelMask, 2);
+    putLe(e->raw + 5, cjcMask & channelMask, 2);
+    e->raw[11] = 0;
+    e->size = TELEMETRY_HEADER_SIZE;
+    e->channelMask = channelMask;
+    for (i = 0; i < TELEMETRY_CHANNEL_MAX; i++)
+    {
+        e->lastRaw[i] = 0;
+        e->lastCentiC[i] = 0;
+    }
+}
+
+// Add a scan, raw[] and centiC[] indexed by channel
+// Returns false, with nothing added, if the frame has no room for it, holds
+// TELEMETRY_SCAN_MAX scans or the scan is 2^31 ms or more after the last;
+// the first scan of a frame always fits
+bool addTelemetryScan(TELEMETRY_ENCODER *e, uint32_t timestampMs, bool fault, const int16_t raw[],
+                      const int32_t centiC[])
+{
+    uint8_t scan[TELEMETRY_SCAN_SIZE_MAX];
+    uint8_t count = e->raw[11];
+    uint32_t deltaMs = timestampMs - e->lastMs;
+    uint8_t n, i;
+
+    if (count == 0)
+    {
+        putLe(e->raw + 7, timestampMs, 4);
+        deltaMs = 0;
+    }
+    if (count == TELEMETRY_SCAN_MAX || deltaMs > 0x7FFFFFFF)
+        return false;
+    n = putVarint(scan, deltaMs * 2 + fault);
+    for (i = 0; i < TELEMETRY_CHANNEL_MAX; i++)
+    {
+        if (!(e->channelMask & (1 << i)))
+            continue;
+        n += putVarint(scan + n, zigzag(raw[i] - e->lastRaw[i]));
+        n += putVarint(scan + n, zigzag(clampCenti(centiC[i]) - e->lastCentiC[i]));
+    }
+    if (e->size + n + TELEMETRY_CRC_SIZE > TELEMETRY_RAW_MAX)
+        return false;
+
+    memcpy(e->raw + e->size, scan, n);
+    e->size += n;
+    e->raw[11] = count + 1;
+    e->lastMs = timestampMs;
+    for (i = 0; i < TELEMETRY_CHANNEL_MAX; i++)
+    {
+        if (!(e->channelMask & (1 << i)))
+            continue;
+        e->lastRaw[i] = raw[i];
+        e->lastCentiC[i] = clampCenti(centiC[i]);
+    }
+    return true;
+}
+
+uint8_t getTelemetryScanCount(const TELEMETRY_ENCODER *e)
+{
+    return e->size == 0 ? 0 : e->raw[11];
+}
+
+uint32_t getTelemetryStartMs(const TELEMETRY_ENCODER *e)
+{
+    return getLe(e->raw + 7, 4);
+}
+
+// Close the frame into out[] (TELEMETRY_ENCODED_MAX bytes) ending with 0x00
+// and empty the encoder
+// Returns the number of bytes to send
+uint16_t finishTelemetry(TELEMETRY_ENCODER *e, uint8_t out[])
+{
+    uint16_t size;
+
+    putLe(e->raw + e->size, crc16(e->raw, e->size), 2);
+    size = cobsEncode(e->raw, e->size + TELEMETRY_CRC_SIZE, out);
+    out[size++] = 0;
+    e->size = 0;
+    return size;
+}
+
+// Decode one frame, in[] is everything between two 0x00 delimiters
+// Returns false for a bad length, CRC, version or varint
+bool decodeTelemetry(const uint8_t in[], uint16_t size, TELEMETRY_FRAME *frame)
+{
+    uint8_t raw[TELEMETRY_RAW_MAX];
+    const uint8_t *p = raw + TELEMETRY_HEADER_SIZE;
+    const uint8_t *end;
+    TELEMETRY_SCAN *scan, *last = 0;
+    uint32_t timestampMs, value;
+    uint16_t rawSize;
+    uint8_t n, i, j;
+
+    rawSize = cobsDecode(in, size, raw, sizeof(raw));
+    if (rawSize < TELEMETRY_HEADER_SIZE + TELEMETRY_CRC_SIZE)
+        return false;
+    rawSize -= TELEMETRY_CRC_SIZE;
+    if (getLe(raw + rawSize, 2) != crc16(raw, rawSize))
+        return false;
+    if (raw[0] != TELEMETRY_VERSION || raw[11] > TELEMETRY_SCAN_MAX)
+        return false;
+
+    frame->version = raw[0];
+    frame->sequence = getLe(raw + 1, 2);
+    frame->channelMask = getLe(raw + 3, 2);
+    frame->cjcMask = getLe(raw + 5, 2);
+    timestampMs = getLe(raw + 7, 4);
+    frame->count = raw[11];
+    end = raw + rawSize;
+    for (i = 0; i < frame->count; i++)
+    {
+        scan = &frame->scan[i];
+        if ((n = getVarint(p, end, &value)) == 0)
+            return false;
+        p += n;
+        timestampMs += value >> 1;
+        scan->timestampMs = timestampMs;
+        scan->fault = value & 1;
+        for (j = 0; j < TELEMETRY_CHANNEL_MAX; j++)
+        {
+            scan->raw[j] = 0;
+            scan->centiC[j] = 0;
+            if (!(frame->channelMask & (1 << j)))
+                continue;
+            if ((n = getVarint(p, end, &value)) == 0)
+                return false;
+            p += n;
+            scan->raw[j] = (last ? last->raw[j] : 0) + unzigzag(value);
+            if ((n = getVarint(p, end, &value)) == 0)
+                return false;
+            p += n;
+            scan->centiC[j] = (last ? last->centiC[j] : 0) + unzigzag(value);
+        }
+        last = scan;
+    }
+    return p == end;
+}
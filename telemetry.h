@@ -0,0 +1,103 @@
+// Telemetry Frame Library
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    40 MHz
+
+// Hardware configuration:
+// None, the encoder and decoder are portable C so a host can decode frames
+// with the same code
+
+//-----------------------------------------------------------------------------
+// Device includes, defines, and assembler directives
+//-----------------------------------------------------------------------------
+
+#ifndef TELEMETRY_H_
+#define TELEMETRY_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define TELEMETRY_VERSION      2
+#define TELEMETRY_CHANNEL_MAX  16
+#define TELEMETRY_SCAN_MAX     64
+
+// Frame layout before COBS, little endian:
+//   version (1), sequence (2), channel mask (2), CJC channel mask (2),
+//   timestamp ms of the first scan (4), scan count (1)
+//   per scan: ms since the previous scan times 2, plus 1 if the scan
+//             failed (varint)
+//             per channel in the mask, lowest first: raw ADC counts, then
+//             0.01 C clamped to 24 bits, each as the change from the
+//             previous scan of the frame (zigzag varint)
+//   CRC16-CCITT of everything before it (2)
+// A varint carries 7 bits per byte, low first, with bit 7 set on every byte
+// but the last; zigzag maps 0, -1, 1, -2 ... to 0, 1, 2, 3 ..., so a reading
+// that moved by less than 64 takes one byte; the first scan moves from 0
+// An ADC at full scale reads INT16_MAX or INT16_MIN, the host checks raw
+// COBS removes every zero byte and a single 0x00 ends the frame
+#define TELEMETRY_HEADER_SIZE  12
+#define TELEMETRY_CRC_SIZE     2
+#define TELEMETRY_RAW_MAX      240                      // header, scans and CRC
+#define TELEMETRY_SCAN_SIZE_MAX (5 + TELEMETRY_CHANNEL_MAX * (3 + 4))
+
+// COBS adds one byte per 254 plus the delimiter
+#define TELEMETRY_ENCODED_MAX  (TELEMETRY_RAW_MAX + TELEMETRY_RAW_MAX / 254 + 2)
+
+// Frame being filled by the sender, size 0 when empty
+typedef struct _TELEMETRY_ENCODER
+{
+    uint8_t raw[TELEMETRY_RAW_MAX];
+    uint16_t size;                                      // header and scans so far
+    uint16_t channelMask;
+    uint32_t lastMs;
+    int16_t lastRaw[TELEMETRY_CHANNEL_MAX];
+    int32_t lastCentiC[TELEMETRY_CHANNEL_MAX];
+} TELEMETRY_ENCODER;
+
+// One decoded scan, indexed by channel, channels not in the mask are 0
+typedef struct _TELEMETRY_SCAN
+{
+    uint32_t timestampMs;
+    bool fault;                                         // transfer failed, values are 0
+    int16_t raw[TELEMETRY_CHANNEL_MAX];
+    int32_t centiC[TELEMETRY_CHANNEL_MAX];
+} TELEMETRY_SCAN;
+
+typedef struct _TELEMETRY_FRAME
+{
+    uint8_t version;
+    uint16_t sequence;
+    uint16_t channelMask;
+    uint16_t cjcMask;                                   // cold junction sensors
+    uint8_t count;
+    TELEMETRY_SCAN scan[TELEMETRY_SCAN_MAX];
+} TELEMETRY_FRAME;
+
+//-----------------------------------------------------------------------------
+// Subroutines
+//-----------------------------------------------------------------------------
+
+// C linkage so a C++ host tool can link telemetry.c as built
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+uint16_t crc16(const uint8_t data[], uint16_t size);
+void startTelemetry(TELEMETRY_ENCODER *e, uint16_t sequence, uint16_t channelMask, uint16_t cjcMask);
+bool addTelemetryScan(TELEMETRY_ENCODER *e, uint32_t timestampMs, bool fault, const int16_t raw[],
+                      const int32_t centiC[]);
+uint8_t getTelemetryScanCount(const TELEMETRY_ENCODER *e);
+uint32_t getTelemetryStartMs(const TELEMETRY_ENCODER *e);
+uint16_t finishTelemetry(TELEMETRY_ENCODER *e, uint8_t out[]);
+bool decodeTelemetry(const uint8_t in[], uint16_t size, TELEMETRY_FRAME *frame);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,86 @@
+// Formatter Benchmark
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, built and run by make -C tests bench
+// Host timings compare the formatters with snprintf, the firmware saving is
+// larger since newlib printf also pulls in float support and a deep stack
+
+//-----------------------------------------------------------------------------
+// Device includes, defines, and assembler directives
+//-----------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "bench.h"
+#include "uart0.h"
+#include "fmt.h"
+
+#define COUNT  10000000
+#define VALUES 1024                                     // power of 2
+
+static int32_t values[VALUES];
+
+//-----------------------------------------------------------------------------
+// Subroutines
+//-----------------------------------------------------------------------------
+
+// ns per value, the stub ring is emptied whenever a value might not fit
+static double benchFmt(uint8_t decimals)
+{
+    double start = benchSeconds();
+    uint32_t i;
+
+    resetStubTx(STUB_TX_SIZE);
+    for (i = 0; i < COUNT; i++)
+    {
+        if (stubTxFree < 16)
+            resetStubTx(STUB_TX_SIZE);
+        if (decimals)
+            fmt_fixed(values[i & (VALUES - 1)], decimals);
+        else
+            fmt_i32(values[i & (VALUES - 1)]);
+    }
+    benchSink = stubTxCount;
+    return (benchSeconds() - start) * 1e9 / COUNT;
+}
+
+static double benchSnprintf(uint8_t decimals)
+{
+    char text[16];
+    double start = benchSeconds();
+    uint32_t i;
+    int n = 0;
+
+    for (i = 0; i < COUNT; i++)
+    {
+        if (decimals)
+            n += snprintf(text, sizeof(text), "%.2f", values[i & (VALUES - 1)] / 100.0);
+        else
+            n += snprintf(text, sizeof(text), "%d", values[i & (VALUES - 1)]);
+    }
+    benchSink = n;
+    return (benchSeconds() - start) * 1e9 / COUNT;
+}
+
+//-----------------------------------------------------------------------------
+// Main
+//-----------------------------------------------------------------------------
+
+int main(void)
+{
+    uint16_t i;
+
+    // temperatures in 0.01 C from -270 to 1372 C
+    srand(1);
+    for (i = 0; i < VALUES; i++)
+        values[i] = rand() % 164200 - 27000;
+
+    printf("ns per value   fmt      snprintf\n");
+    printf("integer        %5.1f    %5.1f\n", benchFmt(0), benchSnprintf(0));
+    printf("fixed, 2 dp    %5.1f    %5.1f\n", benchFmt(2), benchSnprintf(2));
+    return 0;
+}
@@ -0,0 +1,129 @@
+// Command Parser Benchmark
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, built and run by make -C tests bench
+// Lines go through parseFields and dispatchCommand of UART0.c as built for
+// the simulator; nothing here touches a register, so the simulator is not
+// started
+// The strcmp chain is the lookup the hashed table replaced
+
+//-----------------------------------------------------------------------------
+// Device includes, defines, and assembler directives
+//-----------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include "bench.h"
+#include "UART0.h"
+
+#define COUNT 1000000
+
+static uint32_t handled;
+
+static void countCommand(USER_DATA *data)
+{
+    handled += data->fieldCount;
+}
+
+// The firmware verbs, see i2c_utility.c
+#define COMMANDS(X) \
+    X('i', 'c', 3, "i2c",    0, countCommand) \
+    X('u', 't', 4, "uart",   0, countCommand) \
+    X('f', 't', 6, "format", 1, countCommand) \
+    X('b', 'd', 4, "baud",   1, countCommand) \
+    X('s', 'm', 6, "stream", 3, countCommand)
+
+static const COMMAND commands[COMMAND_SLOTS] = { COMMANDS(COMMAND_ENTRY) };
+COMMAND_SLOTS_UNIQUE(COMMANDS);
+
+#define CHAIN(first, last, length, verb, minArguments, handler) { verb, minArguments, handler },
+
+static const COMMAND chain[] = { COMMANDS(CHAIN) };
+
+#define CHAIN_COUNT (sizeof(chain) / sizeof(chain[0]))
+
+static const char *lines[] =
+{
+    "stream 100 0xFF binary", "baud 115200", "format text", "i2c clear", "uart",
+    "stream 10 3 text", "bogus 1.5", "baud",
+};
+
+#define LINE_COUNT (sizeof(lines) / sizeof(lines[0]))
+
+//-----------------------------------------------------------------------------
+// Subroutines
+//-----------------------------------------------------------------------------
+
+// The lookup before the hashed table, one strcmp per verb until a match
+static bool dispatchChain(USER_DATA *data)
+{
+    const char *verb = getFieldString(data, 0);
+    uint8_t i;
+
+    for (i = 0; i < CHAIN_COUNT; i++)
+    {
+        if (strcmp(chain[i].verb, verb) == 0)
+        {
+            if (data->fieldCount - 1 < chain[i].minArguments)
+                return false;
+            chain[i].handler(data);
+            return true;
+        }
+    }
+    return false;
+}
+
+// ns per line copied into the buffer and parsed, then looked up by lookup
+// unless it is 0
+static double benchParse(bool (*lookup)(USER_DATA *data))
+{
+    USER_DATA data;
+    double start = benchSeconds();
+    uint32_t i, found = 0;
+
+    handled = 0;
+    for (i = 0; i < COUNT; i++)
+    {
+        strcpy(data.buffer, lines[i % LINE_COUNT]);
+        parseFields(&data);
+        if (lookup)
+            found += lookup(&data);
+        else
+            found += data.fieldCount;
+    }
+    benchSink = found + handled;
+    return (benchSeconds() - start) * 1e9 / COUNT;
+}
+
+static bool dispatchTable(USER_DATA *data)
+{
+    return dispatchCommand(data, commands);
+}
+
+//-----------------------------------------------------------------------------
+// Main
+//-----------------------------------------------------------------------------
+
+int main(void)
+{
+    double parse, table, chained;
+
+    if (!checkCommands(commands))
+    {
+        printf("command table has a verb outside of its slot\n");
+        return 1;
+    }
+    parse = benchParse(0);
+    table = benchParse(dispatchTable);
+    chained = benchParse(dispatchChain);
+    printf("ns per line        total   lookup\n");
+    printf("parseFields        %5.1f\n", parse);
+    printf("hashed table       %5.1f    %5.1f\n", table, table - parse);
+    printf("strcmp chain       %5.1f    %5.1f\n", chained, chained - parse);
+    return 0;
+}
@@ -0,0 +1,88 @@
+// Batch Conversion Benchmark
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, built and run by make -C tests bench
+
+//-----------------------------------------------------------------------------
+// Device includes, defines, and assembler directives
+//-----------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "bench.h"
+#include "tc_batch.h"
+#include "typek.h"
+
+// Logs are reprocessed in chunks of this many samples
+#define CHUNK 1000000
+
+//-----------------------------------------------------------------------------
+// Subroutines
+//-----------------------------------------------------------------------------
+
+// The firmware path, one sample at a time through the table engine
+static void convertScalar(const int16_t *rawTc, const int16_t *rawCjc, float *out, size_t n)
+{
+    size_t k;
+    float cjcC;
+
+    for (k = 0; k < n; k++)
+    {
+        cjcC = (rawCjc[k] * 62.5f - 750000.0f) * 0.0001f + 25.0f;
+        out[k] = typek_table_mv_to_temp(rawTc[k] * 0.0078125f + typek_table_temp_to_mv(cjcC));
+    }
+}
+
+// Samples per second over total samples, CHUNK at a time
+static double run(void (*convert)(const int16_t *, const int16_t *, float *, size_t),
+                  const int16_t *rawTc, const int16_t *rawCjc, float *out, uint32_t total)
+{
+    double start = benchSeconds();
+    uint32_t done;
+
+    for (done = 0; done < total; done += CHUNK)
+    {
+        convert(rawTc, rawCjc, out, CHUNK);
+        benchSink += out[done % CHUNK];
+    }
+    return total / (benchSeconds() - start);
+}
+
+//-----------------------------------------------------------------------------
+// Main
+//-----------------------------------------------------------------------------
+
+int main(void)
+{
+    static const uint32_t totals[] = { 1000000, 100000000 };
+    int16_t *rawTc = malloc(CHUNK * sizeof(int16_t));
+    int16_t *rawCjc = malloc(CHUNK * sizeof(int16_t));
+    float *out = malloc(CHUNK * sizeof(float));
+    uint32_t k;
+    uint8_t i;
+
+    // thermocouple voltages of -200 to 1300 C against a 0 C junction, -5891
+    // to 52410 uV or -754 to 6708 counts, cold junction around 15-35 C
+    srand(1);
+    for (k = 0; k < CHUNK; k++)
+    {
+        rawTc[k] = rand() % 7463 - 754;
+        rawCjc[k] = 14400 + rand() % 3200;
+    }
+
+    for (i = 0; i < sizeof(totals) / sizeof(totals[0]); i++)
+    {
+        printf("%9u samples: convert_batch %6.1f M/s, scalar %6.1f M/s\n", totals[i],
+               run(convert_batch, rawTc, rawCjc, out, totals[i]) * 1e-6,
+               run(convertScalar, rawTc, rawCjc, out, totals[i]) * 1e-6);
+    }
+    free(rawTc);
+    free(rawCjc);
+    free(out);
+    return 0;
+}
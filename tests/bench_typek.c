@@ -0,0 +1,192 @@
+// Type K Engine Benchmark
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, built and run by make -C tests bench
+// Host timings only rank the engines, the MCU has no FPU in the default build
+// Built with the default 10 C table, whose breakpoints are the rungs of the
+// original if-chain
+
+//-----------------------------------------------------------------------------
+// Device includes, defines, and assembler directives
+//-----------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <stdio.h>
+#include <math.h>
+#include "bench.h"
+#include "typek.h"
+#include "typek_chain.h"
+
+#define COUNT 10000000
+
+// Every NIST point, 1 C apart from -270 to 1372 C
+typedef struct _NIST_POINT
+{
+    int16_t t;
+    int32_t uv;
+} NIST_POINT;
+
+#define NIST_BEGIN(t, uv) { t, uv },
+#define NIST10(t, uv) { t, uv },
+#define NIST5(t, uv) { t, uv },
+#define NIST1(t, uv) { t, uv },
+#define NIST_END(t, uv) { t, uv }
+
+static const NIST_POINT nist[] =
+{
+#include "typek_nist.h"
+};
+
+#define NIST_COUNT (sizeof(nist) / sizeof(nist[0]))
+#define LADDER_RUNGS 165
+
+typedef struct _BENCH_RESULT
+{
+    double ns;
+    double cycles;
+} BENCH_RESULT;
+
+//-----------------------------------------------------------------------------
+// Subroutines
+//-----------------------------------------------------------------------------
+
+// Temperatures and voltages sweep the whole range so every segment is used
+// Each input is computed from its index in double, so the sweep ends on max
+static BENCH_RESULT benchFloat(float (*convert)(float), double min, double max)
+{
+    BENCH_RESULT r;
+    double sum = 0;
+    double start = benchSeconds();
+    uint64_t cycles = benchCycles();
+    uint32_t i;
+
+    for (i = 0; i < COUNT; i++)
+        sum += convert(min + i * (max - min) / (COUNT - 1));
+    r.cycles = (double)(benchCycles() - cycles) / COUNT;
+    r.ns = (benchSeconds() - start) * 1e9 / COUNT;
+    benchSink = sum;
+    return r;
+}
+
+static BENCH_RESULT benchInteger(int32_t (*convert)(int32_t), int32_t min, int32_t max)
+{
+    BENCH_RESULT r;
+    int32_t x = min;
+    int64_t sum = 0;
+    double start = benchSeconds();
+    uint64_t cycles = benchCycles();
+    uint32_t i;
+
+    for (i = 0; i < COUNT; i++)
+    {
+        sum += convert(x);
+        if (++x > max)
+            x = min;
+    }
+    r.cycles = (double)(benchCycles() - cycles) / COUNT;
+    r.ns = (benchSeconds() - start) * 1e9 / COUNT;
+    benchSink = sum;
+    return r;
+}
+
+// Comparisons per reverse lookup averaged over the mV sweep
+// The binary search halves the segment count whatever the input, the ladder
+// tests the lower bound of every rung and the upper bound of each rung at or
+// below the input
+static void countComparisons(double *search, double *ladder)
+{
+    uint16_t n = TYPEK_SEGMENT_COUNT;
+    uint16_t steps = 0;
+    uint64_t total = 0;
+    uint16_t rung = 0;
+    int32_t uv;
+
+    while (n > 1)
+    {
+        n -= n / 2;
+        steps++;
+    }
+    for (uv = TYPEK_UV_MIN; uv <= TYPEK_UV_MAX; uv++)
+    {
+        while (rung < LADDER_RUNGS - 1 && typekUv[rung + 1] <= uv)
+            rung++;
+        total += LADDER_RUNGS + rung + 1;
+    }
+    *search = steps;
+    *ladder = (double)total / (TYPEK_UV_MAX - TYPEK_UV_MIN + 1);
+}
+
+// Largest error against the NIST points, forward in uV and reverse in deg C
+// Reverse errors are taken from -200 C where NIST gives an inverse, and both
+// stop at 1370 C where the if-chain leaves type K
+static void maxError(const char *name, float (*forward)(float), float (*reverse)(float))
+{
+    double uvError = 0, cError = 0, e;
+    uint16_t i;
+
+    for (i = 0; i < NIST_COUNT && nist[i].t <= 1370; i++)
+    {
+        e = fabs(forward(nist[i].t) * 1000 - nist[i].uv);
+        uvError = e > uvError ? e : uvError;
+        if (nist[i].t >= -200)
+        {
+            e = fabs(reverse(nist[i].uv / 1000.0f) - nist[i].t);
+            cError = e > cError ? e : cError;
+        }
+    }
+    printf("%-20s%8.2f %8.3f\n", name, uvError, cError);
+}
+
+static float fixedTempToMv(float t)
+{
+    return typek_fixed_temp_to_uv((int32_t)lroundf(t * 100)) * 0.001f;
+}
+
+static float fixedMvToTemp(float mv)
+{
+    return typek_fixed_uv_to_temp((int32_t)lroundf(mv * 1000)) * 0.01f;
+}
+
+static void printResult(const char *name, BENCH_RESULT forward, BENCH_RESULT reverse)
+{
+    printf("%-20s%8.1f %8.1f   %8.1f %8.1f\n", name, forward.ns, forward.cycles, reverse.ns, reverse.cycles);
+}
+
+//-----------------------------------------------------------------------------
+// Main
+//-----------------------------------------------------------------------------
+
+int main(void)
+{
+    double search, ladder;
+
+    printf("per conversion      temp to mV          mV to temp\n");
+    printf("                          ns   cycles         ns   cycles\n");
+    printResult("if-chain (float)",
+                benchFloat(chainTempToMv, TYPEK_T_MIN, 1370),
+                benchFloat(chainMvToTemp, TYPEK_MV_MIN, 54.819));
+    printResult("table (float)",
+                benchFloat(typek_table_temp_to_mv, TYPEK_T_MIN, TYPEK_T_MAX),
+                benchFloat(typek_table_mv_to_temp, TYPEK_MV_MIN, TYPEK_MV_MAX));
+    printResult("fixed (integer)",
+                benchInteger(typek_fixed_temp_to_uv, TYPEK_T_MIN * 100, TYPEK_T_MAX * 100),
+                benchInteger(typek_fixed_uv_to_temp, TYPEK_UV_MIN, TYPEK_UV_MAX));
+    printResult("polynomial (float)",
+                benchFloat(typek_poly_temp_to_mv, TYPEK_T_MIN, TYPEK_T_MAX),
+                benchFloat(typek_poly_mv_to_temp, TYPEK_MV_MIN, TYPEK_MV_MAX));
+
+    countComparisons(&search, &ladder);
+    printf("\ncomparisons per mV to temp lookup\n");
+    printf("binary search       %8.1f\n", search);
+    printf("if-ladder           %8.1f\n", ladder);
+
+    printf("\nmax error vs NIST    uV        C\n");
+    maxError("if-chain (float)", chainTempToMv, chainMvToTemp);
+    maxError("table (float)", typek_table_temp_to_mv, typek_table_mv_to_temp);
+    maxError("fixed (integer)", fixedTempToMv, fixedMvToTemp);
+    maxError("polynomial (float)", typek_poly_temp_to_mv, typek_poly_mv_to_temp);
+    return 0;
+}
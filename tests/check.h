@@ -0,0 +1,52 @@
+// Host Test Support
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, built and run by tests/Makefile
+
+//-----------------------------------------------------------------------------
+// Device includes, defines, and assembler directives
+//-----------------------------------------------------------------------------
+
+#ifndef CHECK_H_
+#define CHECK_H_
+
+#include <stdio.h>
+
+// Failed checks in this test program, main returns checkResult(argv[0])
+static int checkFailures = 0;
+
+// Report a failed condition with its location and keep going, so one run
+// shows every failure
+#define CHECK(cond)                                                         \
+    do                                                                      \
+    {                                                                       \
+        if (!(cond))                                                        \
+        {                                                                   \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+            checkFailures++;                                                \
+        }                                                                   \
+    } while (0)
+
+// Same with the values of a numeric comparison printed
+#define CHECK_NEAR(actual, expected, tolerance)                                         \
+    do                                                                                  \
+    {                                                                                   \
+        double a_ = (actual), e_ = (expected);                                          \
+        if (a_ - e_ > (tolerance) || e_ - a_ > (tolerance))                             \
+        {                                                                               \
+            printf("%s:%d: %s = %g, expected %g +/- %g\n", __FILE__, __LINE__, #actual, \
+                   a_, e_, (double)(tolerance));                                        \
+            checkFailures++;                                                            \
+        }                                                                               \
+    } while (0)
+
+static int checkResult(const char *name)
+{
+    printf("%s: %s\n", name, checkFailures ? "FAIL" : "ok");
+    return checkFailures != 0;
+}
+
+#endif
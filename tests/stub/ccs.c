@@ -0,0 +1,24 @@
+// CCS Intrinsics Stub
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, built and run by tests/Makefile
+
+//-----------------------------------------------------------------------------
+// Device includes, defines, and assembler directives
+//-----------------------------------------------------------------------------
+
+#include <stdint.h>
+#include "ccs.h"
+
+//-----------------------------------------------------------------------------
+// Subroutines
+//-----------------------------------------------------------------------------
+
+// Only used to let peripheral clocks settle, nothing to wait for here
+void _delay_cycles(uint32_t cycles)
+{
+    (void)cycles;
+}
@@ -0,0 +1,21 @@
+// CCS Intrinsics Stub
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, built and run by tests/Makefile
+// Forced into driver sources that call compiler intrinsics
+
+//-----------------------------------------------------------------------------
+// Device includes, defines, and assembler directives
+//-----------------------------------------------------------------------------
+
+#ifndef CCS_STUB_H_
+#define CCS_STUB_H_
+
+#include <stdint.h>
+
+void _delay_cycles(uint32_t cycles);
+
+#endif
@@ -0,0 +1,183 @@
+// GPIO Stub
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, built and run by tests/Makefile
+// Pin state for the simulator: a pin is driven by its peripheral (aux), by
+// GPIO as an output, or left as an input that reads what the outside drives
+
+//-----------------------------------------------------------------------------
+// Device includes, defines, and assembler directives
+//-----------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "tm4c123gh6pm.h"
+#include "gpio.h"
+#include "sim.h"
+
+typedef struct _PIN
+{
+    bool aux;
+    bool output;
+    bool openDrain;
+    bool value;
+    bool pullup;
+    bool rising;
+    bool interrupt;
+    bool flag;
+    bool level;                                         // line level at the last update
+    bool (*input)(PORT port, uint8_t pin);
+    void (*changed)(PORT port, uint8_t pin, bool level);
+} PIN;
+
+//-----------------------------------------------------------------------------
+// Global variables
+//-----------------------------------------------------------------------------
+
+static PIN pins[PORT_COUNT][8];
+
+static const uint8_t portVector[PORT_COUNT] =
+{
+    INT_GPIOA, INT_GPIOB, INT_GPIOC, INT_GPIOD, INT_GPIOE, INT_GPIOF
+};
+
+//-----------------------------------------------------------------------------
+// Subroutines
+//-----------------------------------------------------------------------------
+
+// A GPIO output low always wins, an open-drain or released line reads what
+// the outside drives, or the pull-up when nothing is attached
+static bool getLevel(PORT port, uint8_t pin)
+{
+    PIN *p = &pins[port][pin];
+
+    if (!p->aux && p->output && !p->value)
+        return false;
+    if (!p->aux && p->output && !p->openDrain)
+        return true;
+    if (p->input)
+        return p->input(port, pin);
+    return p->pullup;
+}
+
+// The port interrupt is a level, the OR of the enabled pin flags
+static void updatePortIrq(PORT port)
+{
+    bool level = false;
+    uint8_t pin;
+
+    for (pin = 0; pin < 8; pin++)
+        level |= pins[port][pin].flag && pins[port][pin].interrupt;
+    simIrq(portVector[port], level);
+}
+
+// Re-evaluate a line, a rising edge sets the pin flag
+void simUpdatePin(PORT port, uint8_t pin)
+{
+    PIN *p = &pins[port][pin];
+    bool level = getLevel(port, pin);
+
+    if (level == p->level)
+        return;
+    p->level = level;
+    if (level && p->rising)
+    {
+        p->flag = true;
+        updatePortIrq(port);
+    }
+    if (p->changed)
+        p->changed(port, pin, level);
+}
+
+void simSetPinInput(PORT port, uint8_t pin, bool (*level)(PORT port, uint8_t pin))
+{
+    pins[port][pin].input = level;
+    pins[port][pin].level = getLevel(port, pin);
+}
+
+void simSetPinOutput(PORT port, uint8_t pin, void (*changed)(PORT port, uint8_t pin, bool level))
+{
+    pins[port][pin].changed = changed;
+}
+
+bool isSimPinAux(PORT port, uint8_t pin)
+{
+    return pins[port][pin].aux;
+}
+
+void enablePort(PORT port)
+{
+    (void)port;
+}
+
+void selectPinPushPullOutput(PORT port, uint8_t pin)
+{
+    pins[port][pin].aux = false;
+    pins[port][pin].output = true;
+    pins[port][pin].openDrain = false;
+    simUpdatePin(port, pin);
+}
+
+void selectPinOpenDrainOutput(PORT port, uint8_t pin)
+{
+    pins[port][pin].aux = false;
+    pins[port][pin].output = true;
+    pins[port][pin].openDrain = true;
+    simUpdatePin(port, pin);
+}
+
+void selectPinDigitalInput(PORT port, uint8_t pin)
+{
+    pins[port][pin].aux = false;
+    pins[port][pin].output = false;
+    simUpdatePin(port, pin);
+}
+
+void enablePinPullup(PORT port, uint8_t pin)
+{
+    pins[port][pin].pullup = true;
+    simUpdatePin(port, pin);
+}
+
+void setPinAuxFunction(PORT port, uint8_t pin, uint32_t fn)
+{
+    pins[port][pin].aux = fn != 0;
+    simUpdatePin(port, pin);
+}
+
+void selectPinInterruptRisingEdge(PORT port, uint8_t pin)
+{
+    pins[port][pin].rising = true;
+}
+
+void enablePinInterrupt(PORT port, uint8_t pin)
+{
+    pins[port][pin].interrupt = true;
+    updatePortIrq(port);
+}
+
+void disablePinInterrupt(PORT port, uint8_t pin)
+{
+    pins[port][pin].interrupt = false;
+    updatePortIrq(port);
+}
+
+void clearPinInterrupt(PORT port, uint8_t pin)
+{
+    pins[port][pin].flag = false;
+    updatePortIrq(port);
+}
+
+void setPinValue(PORT port, uint8_t pin, bool value)
+{
+    pins[port][pin].value = value;
+    simUpdatePin(port, pin);
+}
+
+bool getPinValue(PORT port, uint8_t pin)
+{
+    return getLevel(port, pin);
+}
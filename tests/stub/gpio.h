@@ -0,0 +1,45 @@
+// GPIO Stub
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, built and run by tests/Makefile
+// Stands in for the GPIO library of the board package, the pins are kept by
+// the simulator (sim.h)
+
+//-----------------------------------------------------------------------------
+// Device includes, defines, and assembler directives
+//-----------------------------------------------------------------------------
+
+#ifndef GPIO_H_
+#define GPIO_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef enum _PORT
+{
+    PORTA, PORTB, PORTC, PORTD, PORTE, PORTF
+} PORT;
+
+#define PORT_COUNT 6
+
+//-----------------------------------------------------------------------------
+// Subroutines
+//-----------------------------------------------------------------------------
+
+void enablePort(PORT port);
+void selectPinPushPullOutput(PORT port, uint8_t pin);
+void selectPinOpenDrainOutput(PORT port, uint8_t pin);
+void selectPinDigitalInput(PORT port, uint8_t pin);
+void enablePinPullup(PORT port, uint8_t pin);
+void setPinAuxFunction(PORT port, uint8_t pin, uint32_t fn);
+void selectPinInterruptRisingEdge(PORT port, uint8_t pin);
+void enablePinInterrupt(PORT port, uint8_t pin);
+void disablePinInterrupt(PORT port, uint8_t pin);
+void clearPinInterrupt(PORT port, uint8_t pin);
+void setPinValue(PORT port, uint8_t pin, bool value);
+bool getPinValue(PORT port, uint8_t pin);
+
+#endif
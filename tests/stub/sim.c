@@ -0,0 +1,345 @@
+// Peripheral Simulator
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC (x86-64 Linux), built and run by tests/Makefile
+// Core of the simulator: register trapping, simulated time, the NVIC and the
+// clock gating registers
+
+// A register access faults on the unreadable mapping; the fault handler
+// fills the cell through an alias mapping of the same memory, opens the page
+// and sets the trap flag, so the access runs once and traps; the trap handler
+// closes the page again and hands a write to its device
+// Tests are built -no-pie so the drivers can keep addresses in 32 bits, as
+// UART0.c does for the uDMA table
+
+//-----------------------------------------------------------------------------
+// Device includes, defines, and assembler directives
+//-----------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <signal.h>
+#include <ucontext.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "tm4c123gh6pm.h"
+#include "sim.h"
+
+#define PERIPH_BASE     0x40000000
+#define PERIPH_SIZE     0x00100000
+#define NVIC_PAGE       0xE000E000
+#define PAGE_SIZE       0x1000
+
+#define DEVICE_MAX      16
+
+// x86 page fault error code and flags
+#define FAULT_WRITE     0x2
+#define EFLAGS_TF       0x100
+
+//-----------------------------------------------------------------------------
+// Global variables
+//-----------------------------------------------------------------------------
+
+static uint8_t *alias;
+static const SIM_DEVICE *devices[DEVICE_MAX];
+static uint8_t deviceCount = 0;
+static SIM_COUNTS counts;
+
+static uint64_t nowNs = 0;
+static SIM_EVENT *events = 0;
+
+// Access between the fault and the trap
+static uint32_t stepAddress;
+static bool stepWrite;
+
+// NVIC, bit n of a word set for vector 16 + 32 * word + n
+static void (*vectors[SIM_VECTORS])(void);
+static uint32_t enabled[5];
+static uint32_t pending[5];
+static uint32_t level[5];
+static bool inIsr = false;
+static bool primask = false;
+
+//-----------------------------------------------------------------------------
+// Subroutines
+//-----------------------------------------------------------------------------
+
+static bool isSimAddress(uintptr_t address)
+{
+    return (address >= PERIPH_BASE && address < PERIPH_BASE + PERIPH_SIZE)
+        || (address >= NVIC_PAGE && address < NVIC_PAGE + PAGE_SIZE);
+}
+
+// Cell of a register in the alias mapping, for the devices
+uint32_t *simCell(uint32_t address)
+{
+    if (address >= NVIC_PAGE)
+        return (uint32_t *)(alias + PERIPH_SIZE + (address - NVIC_PAGE));
+    return (uint32_t *)(alias + (address - PERIPH_BASE));
+}
+
+static const SIM_DEVICE *findDevice(uint32_t address)
+{
+    uint8_t i;
+
+    for (i = 0; i < deviceCount; i++)
+        if (address >= devices[i]->base && address < devices[i]->base + devices[i]->size)
+            return devices[i];
+    return 0;
+}
+
+void simAddDevice(const SIM_DEVICE *device)
+{
+    if (deviceCount == DEVICE_MAX)
+    {
+        fprintf(stderr, "sim: too many devices\n");
+        abort();
+    }
+    devices[deviceCount++] = device;
+}
+
+static void onFault(int signal, siginfo_t *info, void *context)
+{
+    ucontext_t *uc = context;
+    uintptr_t address = (uintptr_t)info->si_addr;
+    const SIM_DEVICE *device;
+
+    (void)signal;
+    if (!isSimAddress(address))
+    {
+        // a real crash, fault again without the handler
+        sigaction(SIGSEGV, &(struct sigaction){ .sa_handler = SIG_DFL }, 0);
+        return;
+    }
+    stepAddress = address & ~3;
+    stepWrite = (uc->uc_mcontext.gregs[REG_ERR] & FAULT_WRITE) != 0;
+    device = findDevice(stepAddress);
+    if (device && device->read)
+        *simCell(stepAddress) = device->read(stepAddress - device->base, stepWrite);
+    mprotect((void *)(uintptr_t)(stepAddress & ~(PAGE_SIZE - 1)), PAGE_SIZE, PROT_READ | PROT_WRITE);
+    uc->uc_mcontext.gregs[REG_EFL] |= EFLAGS_TF;
+}
+
+// The device may take interrupts that access registers again, so the access
+// is copied out before anything else runs
+static void onStep(int signal, siginfo_t *info, void *context)
+{
+    ucontext_t *uc = context;
+    uint32_t address = stepAddress;
+    bool write = stepWrite;
+    const SIM_DEVICE *device;
+
+    (void)signal;
+    (void)info;
+    uc->uc_mcontext.gregs[REG_EFL] &= ~EFLAGS_TF;
+    mprotect((void *)(uintptr_t)(address & ~(PAGE_SIZE - 1)), PAGE_SIZE, PROT_NONE);
+    if (write)
+    {
+        counts.writes++;
+        device = findDevice(address);
+        if (device && device->write)
+            device->write(address - device->base, *simCell(address));
+    }
+    else
+        counts.reads++;
+    simAdvance(SIM_ACCESS_NS);
+}
+
+// Interrupt controller, the set and clear registers read back the state
+static uint32_t nvicRead(uint32_t offset, bool peek)
+{
+    (void)peek;
+    if (offset >= 0x100 && offset < 0x114)
+        return enabled[(offset - 0x100) / 4];
+    if (offset >= 0x180 && offset < 0x194)
+        return enabled[(offset - 0x180) / 4];
+    if (offset >= 0x200 && offset < 0x214)
+        return pending[(offset - 0x200) / 4];
+    if (offset >= 0x280 && offset < 0x294)
+        return pending[(offset - 0x280) / 4];
+    return *simCell(NVIC_PAGE + offset);
+}
+
+static void nvicWrite(uint32_t offset, uint32_t value)
+{
+    if (offset >= 0x100 && offset < 0x114)
+        enabled[(offset - 0x100) / 4] |= value;
+    else if (offset >= 0x180 && offset < 0x194)
+        enabled[(offset - 0x180) / 4] &= ~value;
+    else if (offset >= 0x200 && offset < 0x214)
+        pending[(offset - 0x200) / 4] |= value;
+    else if (offset >= 0x280 && offset < 0x294)
+        pending[(offset - 0x280) / 4] &= ~value;
+}
+
+static const SIM_DEVICE nvic = { NVIC_PAGE, PAGE_SIZE, nvicRead, nvicWrite };
+
+// Clock gating, every peripheral reports ready at once
+static uint32_t sysctlRead(uint32_t offset, bool peek)
+{
+    (void)peek;
+    if (offset >= 0xA00 && offset < 0xB00)
+        return 0xFFFFFFFF;
+    return *simCell(0x400FE000 + offset);
+}
+
+static const SIM_DEVICE sysctl = { 0x400FE000, PAGE_SIZE, sysctlRead, 0 };
+
+// Map the register space and install the handlers, once per program
+void simInit(void)
+{
+    struct sigaction action = { 0 };
+    int fd = memfd_create("sim", 0);
+
+    if (fd < 0 || ftruncate(fd, PERIPH_SIZE + PAGE_SIZE) != 0
+        || mmap((void *)PERIPH_BASE, PERIPH_SIZE, PROT_NONE, MAP_SHARED | MAP_FIXED_NOREPLACE, fd, 0) == MAP_FAILED
+        || mmap((void *)NVIC_PAGE, PAGE_SIZE, PROT_NONE, MAP_SHARED | MAP_FIXED_NOREPLACE, fd, PERIPH_SIZE) == MAP_FAILED)
+    {
+        perror("sim: map");
+        exit(1);
+    }
+    alias = mmap(0, PERIPH_SIZE + PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    action.sa_flags = SA_SIGINFO | SA_NODEFER;
+    action.sa_sigaction = onFault;
+    sigaction(SIGSEGV, &action, 0);
+    action.sa_sigaction = onStep;
+    sigaction(SIGTRAP, &action, 0);
+    simAddDevice(&nvic);
+    simAddDevice(&sysctl);
+}
+
+void getSimCounts(SIM_COUNTS *c)
+{
+    *c = counts;
+}
+
+// Simulated time
+
+uint64_t simNow(void)
+{
+    return nowNs;
+}
+
+void simCancel(SIM_EVENT *e)
+{
+    SIM_EVENT **p;
+
+    if (!e->scheduled)
+        return;
+    for (p = &events; *p != e; p = &(*p)->next);
+    *p = e->next;
+    e->scheduled = false;
+}
+
+// Events due at the same time fire in the order they were scheduled
+void simSchedule(SIM_EVENT *e, uint64_t delayNs)
+{
+    SIM_EVENT **p;
+
+    simCancel(e);
+    e->timeNs = nowNs + delayNs;
+    for (p = &events; *p != 0 && (*p)->timeNs <= e->timeNs; p = &(*p)->next);
+    e->next = *p;
+    *p = e;
+    e->scheduled = true;
+}
+
+// Fire every event up to ns from now, taking interrupts after each
+// An interrupt handler may advance time again, so time only moves forward
+void simAdvance(uint64_t ns)
+{
+    uint64_t end = nowNs + ns;
+    SIM_EVENT *e;
+
+    while (events != 0 && events->timeNs <= end)
+    {
+        e = events;
+        events = e->next;
+        e->scheduled = false;
+        if (e->timeNs > nowNs)
+            nowNs = e->timeNs;
+        e->fire(e->context);
+        simDeliver();
+    }
+    if (end > nowNs)
+        nowNs = end;
+    simDeliver();
+}
+
+// Sleep until the next event, for waitForInterrupt
+// Nothing scheduled means the processor would sleep forever
+void simIdle(void)
+{
+    if (events == 0)
+    {
+        fprintf(stderr, "sim: waiting for an interrupt with no event scheduled\n");
+        abort();
+    }
+    simAdvance(events->timeNs > nowNs ? events->timeNs - nowNs : 0);
+}
+
+// Interrupts
+
+void simVector(uint8_t vector, void (*isr)(void))
+{
+    vectors[vector] = isr;
+}
+
+// Peripheral interrupt lines are levels, a line still high after its handler
+// returns is pended again
+void simIrq(uint8_t vector, bool high)
+{
+    uint8_t n = vector - 16;
+
+    if (high)
+    {
+        level[n / 32] |= 1u << (n % 32);
+        pending[n / 32] |= 1u << (n % 32);
+    }
+    else
+        level[n / 32] &= ~(1u << (n % 32));
+}
+
+void simPend(uint8_t vector)
+{
+    pending[(vector - 16) / 32] |= 1u << ((vector - 16) % 32);
+}
+
+bool simIsPending(uint8_t vector)
+{
+    return (pending[(vector - 16) / 32] >> ((vector - 16) % 32)) & 1;
+}
+
+void simSetPrimask(bool masked)
+{
+    primask = masked;
+    simDeliver();
+}
+
+// Take pending interrupts in vector order, without nesting
+void simDeliver(void)
+{
+    uint8_t vector, n;
+
+    while (!inIsr && !primask)
+    {
+        for (vector = 16; vector < SIM_VECTORS; vector++)
+        {
+            n = vector - 16;
+            if ((pending[n / 32] & enabled[n / 32] & (1u << (n % 32))) && vectors[vector])
+                break;
+        }
+        if (vector == SIM_VECTORS)
+            return;
+        pending[n / 32] &= ~(1u << (n % 32));
+        inIsr = true;
+        vectors[vector]();
+        inIsr = false;
+        pending[n / 32] |= level[n / 32] & (1u << (n % 32));
+    }
+}
@@ -0,0 +1,163 @@
+// Peripheral Simulator
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC (x86-64 Linux), built and run by tests/Makefile
+// Runs the drivers unchanged against simulated TM4C123GH6PM peripherals
+
+// The peripheral space (0x40000000-0x400FFFFF) and the NVIC page are mapped
+// at their real addresses with no access rights, so every register access of
+// the driver faults; the fault handler passes it to the simulated device and
+// single-steps the access
+// Time is simulated: a register access takes SIM_ACCESS_NS, waitMicrosecond
+// and waitForInterrupt move time forward, and device events fire on the way
+// Interrupts are taken between register accesses and inside the waits, one
+// at a time as on a single priority level
+
+//-----------------------------------------------------------------------------
+// Device includes, defines, and assembler directives
+//-----------------------------------------------------------------------------
+
+#ifndef SIM_H_
+#define SIM_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "gpio.h"
+
+#define SIM_SYSCLK      40000000
+#define SIM_CLOCK_NS    25                              // one system clock
+#define SIM_ACCESS_NS   100                             // one register access, about a polling loop pass
+
+#define SIM_VECTORS     155
+
+// A device event, kept in a list ordered by time
+typedef struct _SIM_EVENT
+{
+    uint64_t timeNs;
+    void (*fire)(void *context);
+    void *context;
+    bool scheduled;
+    struct _SIM_EVENT *next;
+} SIM_EVENT;
+
+// Register block of a simulated peripheral
+// read returns the value the next read of offset sees, peek is set when the
+// access is a write so reads with side effects can skip them
+// write is called after the value has been stored
+typedef struct _SIM_DEVICE
+{
+    uint32_t base;
+    uint32_t size;
+    uint32_t (*read)(uint32_t offset, bool peek);
+    void (*write)(uint32_t offset, uint32_t value);
+} SIM_DEVICE;
+
+// Register accesses since simInit, for the traffic tests
+typedef struct _SIM_COUNTS
+{
+    uint32_t reads;
+    uint32_t writes;
+} SIM_COUNTS;
+
+// ADS1115 slave, see sim_i2c.c
+// Faults count down once per transfer they hit
+typedef struct _SIM_ADS1115
+{
+    uint8_t bus;
+    uint8_t add;
+    uint16_t reg[4];                                    // conversion, config, lo and hi thresh
+    uint8_t pointer;
+    uint8_t index;                                      // byte of the current transfer
+    uint8_t msb;
+    bool converting;
+    SIM_EVENT done;
+    int32_t ainUv[4];
+    uint32_t conversions;
+    uint64_t readyNs;                                   // end of the last conversion
+    uint32_t configWrites;
+    uint32_t configReads;
+    uint8_t nackAddress;
+    uint8_t nackData;
+    uint8_t stretchCount;
+    uint32_t stretchNs;
+} SIM_ADS1115;
+
+// Bus side of one simulated I2C master
+typedef struct _SIM_I2C_STATS
+{
+    uint32_t bytes;                                     // address and data bytes clocked
+    uint32_t starts;
+    uint32_t stops;
+    uint64_t busyNs;
+    uint32_t sclPulses;                                 // SCL driven by GPIO during recovery
+} SIM_I2C_STATS;
+
+// UART0 and its uDMA TX channel, see sim_uart.c
+typedef struct _SIM_UART_STATS
+{
+    uint32_t txBytes;                                   // characters sent on U0TX
+    uint32_t cpuWrites;                                 // UARTDR writes of the processor
+    uint32_t dmaWrites;                                 // TX FIFO entries written by channel 9
+    uint32_t txOverruns;                                // UARTDR writes lost to a full FIFO
+    uint32_t rxOverruns;
+    uint32_t txInterrupts;                              // TX FIFO drops to its trigger level
+    uint64_t gapNs;                                     // line idle between characters
+    uint32_t dmaStarts;
+    uint32_t dmaDone;
+    uint32_t dmaErrors;                                 // descriptors the channel cannot run
+    uint32_t descriptor[3];                             // channel 9 as of its last enable
+} SIM_UART_STATS;
+
+//-----------------------------------------------------------------------------
+// Subroutines
+//-----------------------------------------------------------------------------
+
+// Core
+void simInit(void);
+uint64_t simNow(void);
+void simAdvance(uint64_t ns);
+void simIdle(void);
+void simSchedule(SIM_EVENT *e, uint64_t delayNs);
+void simCancel(SIM_EVENT *e);
+void simAddDevice(const SIM_DEVICE *device);
+uint32_t *simCell(uint32_t address);
+void getSimCounts(SIM_COUNTS *counts);
+
+// NVIC
+void simVector(uint8_t vector, void (*isr)(void));
+void simIrq(uint8_t vector, bool level);
+void simPend(uint8_t vector);
+bool simIsPending(uint8_t vector);
+void simDeliver(void);
+void simSetPrimask(bool masked);
+
+// Pins, driven by the gpio.h stand-in
+// level gives what the outside drives onto an input, changed is called when
+// the line of a pin changes
+void simSetPinInput(PORT port, uint8_t pin, bool (*level)(PORT port, uint8_t pin));
+void simSetPinOutput(PORT port, uint8_t pin, void (*changed)(PORT port, uint8_t pin, bool level));
+void simUpdatePin(PORT port, uint8_t pin);
+bool isSimPinAux(PORT port, uint8_t pin);
+
+// General-purpose timers, timer A in 32 bit one-shot or periodic mode
+void simInitTimers(void);
+
+// I2C masters and ADS1115 slaves
+void simInitI2c(void);
+SIM_ADS1115 *simAddAds1115(uint8_t bus, uint8_t add);
+void simHoldSda(uint8_t bus, uint8_t pulses);
+void simDropI2cInterrupts(uint8_t bus, uint8_t count);
+void getSimI2cStats(uint8_t bus, SIM_I2C_STATS *stats);
+uint64_t getSimI2cOverlapNs(void);
+
+// UART0 and uDMA channel 9
+void simInitUart(void);
+void simResetUart(void);
+void simUartReceive(const char *data, uint16_t size);
+uint16_t getSimUartTx(char *data, uint16_t size);
+void getSimUartStats(SIM_UART_STATS *stats);
+
+#endif
@@ -0,0 +1,513 @@
+// I2C and ADS1115 Simulator
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC (x86-64 Linux), built and run by tests/Makefile
+// The four I2C masters at the byte level and ADS1115 slaves on their buses
+
+// A master command takes the bus time of its START, bytes and STOP at the
+// programmed SCL rate, then sets MRIS and the interrupt line
+// Slaves see each byte when the command is issued, the master sees the
+// result when the command completes
+// Continuous conversion mode of the ADS1115 is not modelled
+
+//-----------------------------------------------------------------------------
+// Device includes, defines, and assembler directives
+//-----------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "tm4c123gh6pm.h"
+#include "gpio.h"
+#include "sim.h"
+
+#define I2C_BASE        0x40020000
+#define MASTERS         4
+#define SLAVE_MAX       16
+
+// Master register offsets
+#define MSA             0x000
+#define MCS             0x004
+#define MDR             0x008
+#define MTPR            0x00C
+#define MIMR            0x010
+#define MRIS            0x014
+#define MMIS            0x018
+#define MICR            0x01C
+#define MCR             0x020
+#define MCLKOCNT        0x024
+
+#define MASTER_CODE_NS  22500                           // START and master code at 400 kHz before high-speed
+
+// ADS1115 config register fields
+#define OS              0x8000
+#define MODE_SINGLE     0x0100
+
+typedef struct _MASTER
+{
+    PORT port;
+    uint8_t sclPin;
+    uint8_t sdaPin;
+    uint8_t vector;
+    bool busy;                                          // a command is on the bus
+    bool owned;                                         // START sent, STOP not yet
+    bool clockTimeout;
+    uint8_t status;                                     // MCS error bits of the last command
+    uint8_t ris;
+    uint8_t rx;                                         // byte read by the command
+    bool read;                                          // direction of the addressed transfer
+    SIM_ADS1115 *slave;
+    SIM_EVENT done;
+    uint64_t startNs;
+    uint8_t sdaHeld;                                    // SCL pulses until SDA is released
+    uint8_t dropInterrupts;
+    SIM_I2C_STATS stats;
+} MASTER;
+
+//-----------------------------------------------------------------------------
+// Global variables
+//-----------------------------------------------------------------------------
+
+static MASTER masters[MASTERS] =
+{
+    { .port = PORTB, .sclPin = 2, .sdaPin = 3, .vector = INT_I2C0 },
+    { .port = PORTA, .sclPin = 6, .sdaPin = 7, .vector = INT_I2C1 },
+    { .port = PORTE, .sclPin = 4, .sdaPin = 5, .vector = INT_I2C2 },
+    { .port = PORTD, .sclPin = 0, .sdaPin = 1, .vector = INT_I2C3 },
+};
+
+static SIM_ADS1115 slaves[SLAVE_MAX];
+static uint8_t slaveCount = 0;
+
+// Time with two or more masters on their buses at once
+static uint8_t busyMasters = 0;
+static uint64_t overlapFromNs;
+static uint64_t overlapNs = 0;
+
+//-----------------------------------------------------------------------------
+// Subroutines
+//-----------------------------------------------------------------------------
+
+static uint32_t masterRegister(uint8_t m, uint32_t offset)
+{
+    return *simCell(I2C_BASE + m * 0x1000 + offset);
+}
+
+// ADS1115
+
+// Full scale range in uV by PGA code
+static int32_t getFsrUv(uint8_t pga)
+{
+    static const int32_t fsrUv[8] = { 6144000, 4096000, 2048000, 1024000, 512000, 256000, 256000, 256000 };
+    return fsrUv[pga];
+}
+
+static int16_t convertAds1115(SIM_ADS1115 *s)
+{
+    static const uint8_t positive[8] = { 0, 0, 1, 2, 0, 1, 2, 3 };
+    static const int8_t negative[8] = { 1, 3, 3, 3, -1, -1, -1, -1 };
+    uint8_t mux = (s->reg[1] >> 12) & 7;
+    int64_t uv = s->ainUv[positive[mux]] - (negative[mux] < 0 ? 0 : s->ainUv[negative[mux]]);
+    int64_t fsr = getFsrUv((s->reg[1] >> 9) & 7);
+    int64_t code = (uv * 32768 + (uv >= 0 ? fsr / 2 : -fsr / 2)) / fsr;
+
+    if (code > 32767)
+        code = 32767;
+    if (code < -32768)
+        code = -32768;
+    return code;
+}
+
+// ALERT/RDY is pulled low by every device converting with the comparator in
+// conversion-ready mode (Hi_thresh MSB set, Lo_thresh MSB clear, queue on)
+static bool getAlertLevel(PORT port, uint8_t pin)
+{
+    uint8_t i;
+
+    (void)port;
+    (void)pin;
+    for (i = 0; i < slaveCount; i++)
+        if (slaves[i].converting && (slaves[i].reg[3] & 0x8000) && !(slaves[i].reg[2] & 0x8000)
+            && (slaves[i].reg[1] & 3) != 3)
+            return false;
+    return true;
+}
+
+static void finishConversion(void *context)
+{
+    SIM_ADS1115 *s = context;
+
+    s->reg[0] = convertAds1115(s);
+    s->converting = false;
+    s->conversions++;
+    s->readyNs = simNow();
+    simUpdatePin(PORTB, 5);
+}
+
+static void writeAds1115Byte(SIM_ADS1115 *s, uint8_t data)
+{
+    static const uint32_t sps[8] = { 8, 16, 32, 64, 128, 250, 475, 860 };
+
+    if (s->index == 0)
+        s->pointer = data & 3;
+    else if (s->index == 1)
+        s->msb = data;
+    else if (s->index == 2)
+    {
+        s->reg[s->pointer] = (s->msb << 8) | data;
+        if (s->pointer == 1)
+        {
+            s->configWrites++;
+            if ((s->reg[1] & OS) && (s->reg[1] & MODE_SINGLE))
+            {
+                s->converting = true;
+                simSchedule(&s->done, 1000000000ULL / sps[(s->reg[1] >> 5) & 7]);
+            }
+            simUpdatePin(PORTB, 5);
+        }
+    }
+    s->index++;
+}
+
+// Config reads back OS set while the device is idle
+static uint8_t readAds1115Byte(SIM_ADS1115 *s)
+{
+    uint16_t value = s->reg[s->pointer];
+
+    if (s->pointer == 1)
+    {
+        value = (value & ~OS) | (s->converting ? 0 : OS);
+        if (s->index == 0)
+            s->configReads++;
+    }
+    return s->index++ == 0 ? value >> 8 : value & 0xFF;
+}
+
+SIM_ADS1115 *simAddAds1115(uint8_t bus, uint8_t add)
+{
+    SIM_ADS1115 *s;
+
+    if (slaveCount == SLAVE_MAX)
+    {
+        fprintf(stderr, "sim: too many slaves\n");
+        abort();
+    }
+    s = &slaves[slaveCount++];
+    s->bus = bus;
+    s->add = add;
+    s->reg[0] = 0;
+    s->reg[1] = 0x8583;
+    s->reg[2] = 0x8000;
+    s->reg[3] = 0x7FFF;
+    s->done.fire = finishConversion;
+    s->done.context = s;
+    return s;
+}
+
+static SIM_ADS1115 *findSlave(uint8_t bus, uint8_t add)
+{
+    uint8_t i;
+
+    for (i = 0; i < slaveCount; i++)
+        if (slaves[i].bus == bus && slaves[i].add == add)
+            return &slaves[i];
+    return 0;
+}
+
+// Masters
+
+static void updateMasterIrq(uint8_t m)
+{
+    simIrq(masters[m].vector, (masters[m].ris & masterRegister(m, MIMR)) != 0);
+}
+
+static void setMasterBusy(uint8_t m, bool busy)
+{
+    if (busy == masters[m].busy)
+        return;
+    masters[m].busy = busy;
+    if (busy)
+    {
+        masters[m].startNs = simNow();
+        if (++busyMasters == 2)
+            overlapFromNs = simNow();
+    }
+    else
+    {
+        masters[m].stats.busyNs += simNow() - masters[m].startNs;
+        if (busyMasters-- == 2)
+            overlapNs += simNow() - overlapFromNs;
+    }
+}
+
+static void completeCommand(void *context)
+{
+    MASTER *master = context;
+    uint8_t m = master - masters;
+
+    setMasterBusy(m, false);
+    *simCell(I2C_BASE + m * 0x1000 + MDR) = master->rx;
+    if (master->dropInterrupts > 0)
+        master->dropInterrupts--;
+    else
+        master->ris |= I2C_MRIS_RIS;
+    updateMasterIrq(m);
+}
+
+static void timeoutCommand(void *context)
+{
+    MASTER *master = context;
+    uint8_t m = master - masters;
+
+    setMasterBusy(m, false);
+    master->clockTimeout = true;
+    master->ris |= I2C_MRIS_CLKRIS;
+    updateMasterIrq(m);
+}
+
+// SCL period = 2 * (1 + TPR) * (SCL_LP + SCL_HP) system clocks
+static uint64_t getPeriodNs(uint8_t m)
+{
+    uint32_t mtpr = masterRegister(m, MTPR);
+    return 2ULL * (1 + (mtpr & I2C_MTPR_TPR_M)) * ((mtpr & I2C_MTPR_HS) ? 3 : 10) * SIM_CLOCK_NS;
+}
+
+static void runCommand(uint8_t m, uint32_t mcs)
+{
+    MASTER *master = &masters[m];
+    uint64_t period = getPeriodNs(m);
+    uint64_t ns = 0;
+    uint64_t timeoutNs = (masterRegister(m, MCLKOCNT) & I2C_MCLKOCNT_CNTL_M) * 16 * period;
+    uint32_t msa = masterRegister(m, MSA);
+    SIM_ADS1115 *s;
+
+    if (!(masterRegister(m, MCR) & I2C_MCR_MFE) || master->busy)
+        return;
+    master->done.fire = completeCommand;
+    master->status = 0;
+    master->clockTimeout = false;
+    master->rx = 0xFF;
+    if (!(mcs & I2C_MCS_RUN))
+    {
+        // STOP alone ends a transfer left open after a nack
+        if ((mcs & I2C_MCS_STOP) && master->owned)
+        {
+            master->owned = false;
+            master->stats.stops++;
+            ns = period;
+        }
+    }
+    else
+    {
+        if (mcs & I2C_MCS_START)
+        {
+            if (!master->owned && master->sdaHeld > 0)
+            {
+                master->status = I2C_MCS_ERROR | I2C_MCS_ARBLST;
+                simSchedule(&master->done, period);
+                setMasterBusy(m, true);
+                return;
+            }
+            if ((mcs & I2C_MCS_HS) && !master->owned)
+                ns += MASTER_CODE_NS;
+            master->owned = true;
+            master->stats.starts++;
+            master->stats.bytes++;
+            ns += 10 * period;
+            master->read = msa & 1;
+            master->slave = s = findSlave(m, msa >> 1);
+            if (s && s->nackAddress > 0)
+            {
+                s->nackAddress--;
+                master->slave = s = 0;
+            }
+            if (s)
+            {
+                s->index = 0;
+                if (s->stretchCount > 0)
+                {
+                    s->stretchCount--;
+                    ns += s->stretchNs;
+                    if (s->stretchNs > timeoutNs)
+                    {
+                        master->done.fire = timeoutCommand;
+                        simSchedule(&master->done, timeoutNs);
+                        setMasterBusy(m, true);
+                        return;
+                    }
+                }
+            }
+            else
+                master->status = I2C_MCS_ERROR | I2C_MCS_ADRACK;
+        }
+        if (!(master->status & I2C_MCS_ERROR) && master->owned)
+        {
+            // one data byte
+            master->stats.bytes++;
+            ns += 9 * period;
+            s = master->slave;
+            if (!s)
+                master->status = I2C_MCS_ERROR | I2C_MCS_ADRACK;
+            else if (master->read)
+                master->rx = readAds1115Byte(s);
+            else if (s->nackData > 0)
+            {
+                s->nackData--;
+                master->status = I2C_MCS_ERROR | I2C_MCS_DATACK;
+            }
+            else
+                writeAds1115Byte(s, masterRegister(m, MDR));
+        }
+        if ((mcs & I2C_MCS_STOP) && master->owned)
+        {
+            master->owned = false;
+            master->stats.stops++;
+            ns += period;
+        }
+    }
+    simSchedule(&master->done, ns);
+    setMasterBusy(m, true);
+}
+
+static uint32_t readMaster(uint32_t offset, bool peek)
+{
+    uint8_t m = offset >> 12;
+    MASTER *master = &masters[m];
+    uint32_t status;
+
+    (void)peek;
+    switch (offset & 0xFFF)
+    {
+    case MCS:
+        status = master->status;
+        if (master->busy)
+            status |= I2C_MCS_BUSY;
+        if (!master->busy && !master->owned)
+            status |= I2C_MCS_IDLE;
+        if (master->owned || master->sdaHeld > 0)
+            status |= I2C_MCS_BUSBSY;
+        if (master->clockTimeout)
+            status |= I2C_MCS_CLKTO;
+        return status;
+    case MRIS:
+        return master->ris;
+    case MMIS:
+        return master->ris & masterRegister(m, MIMR);
+    case MICR:
+        return 0;
+    default:
+        return *simCell(I2C_BASE + offset);
+    }
+}
+
+static void writeMaster(uint32_t offset, uint32_t value)
+{
+    uint8_t m = offset >> 12;
+    MASTER *master = &masters[m];
+
+    switch (offset & 0xFFF)
+    {
+    case MCS:
+        runCommand(m, value);
+        break;
+    case MIMR:
+        updateMasterIrq(m);
+        break;
+    case MICR:
+        master->ris &= ~value;
+        updateMasterIrq(m);
+        break;
+    case MCR:
+        // disabling the master abandons the command on the bus
+        if (!(value & I2C_MCR_MFE))
+        {
+            simCancel(&master->done);
+            setMasterBusy(m, false);
+            master->owned = false;
+            master->clockTimeout = false;
+            master->status = 0;
+        }
+        break;
+    }
+}
+
+static const SIM_DEVICE i2cDevice = { I2C_BASE, MASTERS * 0x1000, readMaster, writeMaster };
+
+// Pins
+
+static MASTER *findMaster(PORT port, uint8_t pin)
+{
+    uint8_t m;
+
+    for (m = 0; m < MASTERS; m++)
+        if (masters[m].port == port && (masters[m].sclPin == pin || masters[m].sdaPin == pin))
+            return &masters[m];
+    return 0;
+}
+
+static bool getSclLevel(PORT port, uint8_t pin)
+{
+    (void)port;
+    (void)pin;
+    return true;
+}
+
+static bool getSdaLevel(PORT port, uint8_t pin)
+{
+    return findMaster(port, pin)->sdaHeld == 0;
+}
+
+// A slave holding SDA lets go after enough clocks from GPIO
+static void sclChanged(PORT port, uint8_t pin, bool level)
+{
+    MASTER *master = findMaster(port, pin);
+
+    if (!level || isSimPinAux(port, pin))
+        return;
+    master->stats.sclPulses++;
+    if (master->sdaHeld > 0 && --master->sdaHeld == 0)
+        simUpdatePin(port, master->sdaPin);
+}
+
+void simInitI2c(void)
+{
+    uint8_t m;
+
+    for (m = 0; m < MASTERS; m++)
+    {
+        masters[m].done.context = &masters[m];
+        masters[m].done.fire = completeCommand;
+        simSetPinInput(masters[m].port, masters[m].sclPin, getSclLevel);
+        simSetPinInput(masters[m].port, masters[m].sdaPin, getSdaLevel);
+        simSetPinOutput(masters[m].port, masters[m].sclPin, sclChanged);
+    }
+    simSetPinInput(PORTB, 5, getAlertLevel);
+    simAddDevice(&i2cDevice);
+}
+
+// A slave stuck in the middle of a byte, SDA stays low for pulses clocks
+void simHoldSda(uint8_t bus, uint8_t pulses)
+{
+    masters[bus].sdaHeld = pulses;
+    simUpdatePin(masters[bus].port, masters[bus].sdaPin);
+}
+
+// The next count commands complete without raising the interrupt
+void simDropI2cInterrupts(uint8_t bus, uint8_t count)
+{
+    masters[bus].dropInterrupts = count;
+}
+
+void getSimI2cStats(uint8_t bus, SIM_I2C_STATS *stats)
+{
+    *stats = masters[bus].stats;
+}
+
+uint64_t getSimI2cOverlapNs(void)
+{
+    return overlapNs + (busyMasters >= 2 ? simNow() - overlapFromNs : 0);
+}
@@ -0,0 +1,133 @@
+// Timer Simulator
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC (x86-64 Linux), built and run by tests/Makefile
+// 16/32-bit timers 0-5, timer A counting down in 32 bit one-shot or
+// periodic mode at the system clock; timer B and the other modes are not
+// modelled
+
+//-----------------------------------------------------------------------------
+// Device includes, defines, and assembler directives
+//-----------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "tm4c123gh6pm.h"
+#include "sim.h"
+
+#define TIMER_BASE      0x40030000
+#define TIMERS          6
+
+// Register offsets
+#define TAMR            0x004
+#define CTL             0x00C
+#define IMR             0x018
+#define RIS             0x01C
+#define MIS             0x020
+#define ICR             0x024
+#define TAILR           0x028
+
+typedef struct _TIMER
+{
+    uint8_t vector;
+    uint8_t ris;
+    SIM_EVENT timeout;
+} TIMER;
+
+//-----------------------------------------------------------------------------
+// Global variables
+//-----------------------------------------------------------------------------
+
+static TIMER timers[TIMERS] =
+{
+    { .vector = INT_TIMER0A }, { .vector = INT_TIMER1A }, { .vector = INT_TIMER2A },
+    { .vector = INT_TIMER3A }, { .vector = INT_TIMER4A }, { .vector = INT_TIMER5A },
+};
+
+//-----------------------------------------------------------------------------
+// Subroutines
+//-----------------------------------------------------------------------------
+
+static uint32_t *getRegister(uint8_t t, uint32_t offset)
+{
+    return simCell(TIMER_BASE + t * 0x1000 + offset);
+}
+
+static void updateTimerIrq(uint8_t t)
+{
+    simIrq(timers[t].vector, (timers[t].ris & *getRegister(t, IMR)) != 0);
+}
+
+// TAILR + 1 clocks from enable to time-out
+static void startTimer(uint8_t t)
+{
+    simSchedule(&timers[t].timeout, (*getRegister(t, TAILR) + 1ULL) * SIM_CLOCK_NS);
+}
+
+static void timeOut(void *context)
+{
+    TIMER *timer = context;
+    uint8_t t = timer - timers;
+
+    timer->ris |= TIMER_RIS_TATORIS;
+    if ((*getRegister(t, TAMR) & TIMER_TAMR_TAMR_M) == TIMER_TAMR_TAMR_PERIOD)
+        startTimer(t);
+    else
+        *getRegister(t, CTL) &= ~TIMER_CTL_TAEN;
+    updateTimerIrq(t);
+}
+
+static uint32_t readTimer(uint32_t offset, bool peek)
+{
+    uint8_t t = offset >> 12;
+
+    (void)peek;
+    switch (offset & 0xFFF)
+    {
+    case RIS:
+        return timers[t].ris;
+    case MIS:
+        return timers[t].ris & *getRegister(t, IMR);
+    default:
+        return *simCell(TIMER_BASE + offset);
+    }
+}
+
+static void writeTimer(uint32_t offset, uint32_t value)
+{
+    uint8_t t = offset >> 12;
+
+    switch (offset & 0xFFF)
+    {
+    case CTL:
+        if (!(value & TIMER_CTL_TAEN))
+            simCancel(&timers[t].timeout);
+        else if (!timers[t].timeout.scheduled)
+            startTimer(t);
+        break;
+    case IMR:
+        updateTimerIrq(t);
+        break;
+    case ICR:
+        timers[t].ris &= ~value;
+        updateTimerIrq(t);
+        break;
+    }
+}
+
+static const SIM_DEVICE timerDevice = { TIMER_BASE, TIMERS * 0x1000, readTimer, writeTimer };
+
+void simInitTimers(void)
+{
+    uint8_t t;
+
+    for (t = 0; t < TIMERS; t++)
+    {
+        timers[t].timeout.fire = timeOut;
+        timers[t].timeout.context = &timers[t];
+    }
+    simAddDevice(&timerDevice);
+}
@@ -0,0 +1,399 @@
+// UART0 and uDMA Simulator
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC (x86-64 Linux), built and run by tests/Makefile
+// UART0 in 8N1 FIFO mode at the character level, and uDMA channel 9 moving
+// UART0 TX data in basic mode from the primary control structures
+
+// A character leaves the TX FIFO when the shifter takes it and is on the
+// wire one character time later, 10 bits at the programmed divisor
+// The FIFO levels are the reset ones of UARTIFLS, TXRIS is set when the TX
+// FIFO drops to half and RXRIS when the RX FIFO fills to half
+// Channel 9 fills the TX FIFO while it has room, reading the descriptor from
+// the table at UDMACTLBASE and writing the remaining count back after each
+// item as the controller does; the completion sets UDMACHIS and pends the
+// UART0 interrupt
+// The alignment of the control table is not checked, the host ignores the
+// DATA_ALIGN pragma
+
+//-----------------------------------------------------------------------------
+// Device includes, defines, and assembler directives
+//-----------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "tm4c123gh6pm.h"
+#include "sim.h"
+
+#define UART0_BASE      0x4000C000
+#define UDMA_BASE       0x400FF000
+
+// UART register offsets
+#define DR              0x000
+#define FR              0x018
+#define IBRD            0x024
+#define FBRD            0x028
+#define CTL             0x030
+#define IM              0x038
+#define RIS             0x03C
+#define MIS             0x040
+#define ICR             0x044
+#define DMACTL          0x048
+
+// uDMA register offsets
+#define CFG             0x004
+#define CTLBASE         0x008
+#define ENASET          0x028
+#define ENACLR          0x02C
+#define CHIS            0x504
+
+#define FIFO_SIZE       16
+#define FIFO_TRIGGER    8                               // 1/2, the reset level of both FIFOs
+#define RX_TIMEOUT_BITS 32
+#define WIRE_SIZE       4096
+#define INPUT_SIZE      256
+
+#define TX_CHANNEL      9
+#define TX_CHANNEL_BIT  (1 << TX_CHANNEL)
+
+// Channel 9 control word the UART TX can take: byte items from memory to a
+// fixed register in basic mode
+#define TX_CONTROL_M    (UDMA_CHCTL_DSTINC_M | UDMA_CHCTL_DSTSIZE_M | UDMA_CHCTL_SRCINC_M \
+                        | UDMA_CHCTL_SRCSIZE_M | UDMA_CHCTL_XFERMODE_M)
+#define TX_CONTROL      (UDMA_CHCTL_DSTINC_NONE | UDMA_CHCTL_DSTSIZE_8 | UDMA_CHCTL_SRCINC_8 \
+                        | UDMA_CHCTL_SRCSIZE_8 | UDMA_CHCTL_XFERMODE_BASIC)
+
+typedef struct _FIFO
+{
+    uint8_t data[FIFO_SIZE];
+    uint8_t head;
+    uint8_t count;
+} FIFO;
+
+//-----------------------------------------------------------------------------
+// Global variables
+//-----------------------------------------------------------------------------
+
+static FIFO txFifo, rxFifo;
+static bool shifting = false;
+static uint8_t shiftData;
+static uint32_t ris = 0;
+static SIM_EVENT txDone, rxDone, rxTimeout;
+
+// Characters the test sends, arriving one character time apart
+static char input[INPUT_SIZE];
+static uint16_t inputHead = 0, inputCount = 0;
+
+// What went out on U0TX
+static char wire[WIRE_SIZE];
+static uint64_t lineFreeNs;                             // end of the last character
+static bool lineUsed = false;
+
+// uDMA
+static uint32_t dmaEnabled = 0;
+static uint32_t dmaChis = 0;
+
+static SIM_UART_STATS stats;
+
+//-----------------------------------------------------------------------------
+// Subroutines
+//-----------------------------------------------------------------------------
+
+static uint32_t *getUartRegister(uint32_t offset)
+{
+    return simCell(UART0_BASE + offset);
+}
+
+static uint32_t *getDmaRegister(uint32_t offset)
+{
+    return simCell(UDMA_BASE + offset);
+}
+
+static void pushFifo(FIFO *fifo, uint8_t data)
+{
+    fifo->data[(fifo->head + fifo->count++) % FIFO_SIZE] = data;
+}
+
+static uint8_t popFifo(FIFO *fifo)
+{
+    uint8_t data = fifo->data[fifo->head];
+
+    fifo->head = (fifo->head + 1) % FIFO_SIZE;
+    fifo->count--;
+    return data;
+}
+
+// 10 bits of 16 clocks, or 8 in high-speed mode, per divisor unit
+static uint64_t getCharNs(void)
+{
+    uint64_t divisor64 = (*getUartRegister(IBRD) & 0xFFFF) * 64 + (*getUartRegister(FBRD) & 0x3F);
+    uint8_t n = (*getUartRegister(CTL) & UART_CTL_HSE) ? 8 : 16;
+
+    return 10 * n * divisor64 * SIM_CLOCK_NS / 64;
+}
+
+static bool isUartOn(uint32_t enable)
+{
+    uint32_t ctl = *getUartRegister(CTL);
+    return (ctl & UART_CTL_UARTEN) && (ctl & enable);
+}
+
+static void updateUartIrq(void)
+{
+    simIrq(INT_UART0, (ris & *getUartRegister(IM)) != 0);
+}
+
+// The shifter takes the next character, the FIFO dropping to the trigger
+// level raises TXRIS
+static void startChar(void)
+{
+    if (shifting || txFifo.count == 0 || !isUartOn(UART_CTL_TXE))
+        return;
+    shiftData = popFifo(&txFifo);
+    shifting = true;
+    if (txFifo.count == FIFO_TRIGGER)
+    {
+        ris |= UART_RIS_TXRIS;
+        stats.txInterrupts++;
+        updateUartIrq();
+    }
+    if (lineUsed)
+        stats.gapNs += simNow() - lineFreeNs;
+    simSchedule(&txDone, getCharNs());
+}
+
+// Channel 9 moves items while the TX FIFO has room
+// The descriptor holds the end of the source, the end of the destination
+// and the control word with the number of items left, minus one
+static void serviceDma(void)
+{
+    uint32_t *descriptor;
+    uint32_t control, left;
+    uint8_t data;
+
+    if (!(dmaEnabled & TX_CHANNEL_BIT) || !(*getDmaRegister(CFG) & UDMA_CFG_MASTEN)
+        || !(*getUartRegister(DMACTL) & UART_DMACTL_TXDMAE))
+        return;
+    descriptor = (uint32_t *)(uintptr_t)(*getDmaRegister(CTLBASE) + TX_CHANNEL * 16);
+    while (txFifo.count < FIFO_SIZE)
+    {
+        control = descriptor[2];
+        left = ((control & UDMA_CHCTL_XFERSIZE_M) >> UDMA_CHCTL_XFERSIZE_S) + 1;
+        data = *(uint8_t *)(uintptr_t)(descriptor[0] - (left - 1));
+        pushFifo(&txFifo, data);
+        stats.dmaWrites++;
+        if (left > 1)
+            descriptor[2] = (control & ~UDMA_CHCTL_XFERSIZE_M) | ((left - 2) << UDMA_CHCTL_XFERSIZE_S);
+        else
+        {
+            descriptor[2] = control & ~(UDMA_CHCTL_XFERSIZE_M | UDMA_CHCTL_XFERMODE_M);
+            dmaEnabled &= ~TX_CHANNEL_BIT;
+            dmaChis |= TX_CHANNEL_BIT;
+            stats.dmaDone++;
+            simPend(INT_UART0);
+            break;
+        }
+    }
+    startChar();
+}
+
+// Check the descriptor when the channel is enabled, a bad one is an error
+// and the channel stays off
+static void enableDma(uint32_t channels)
+{
+    uint32_t *descriptor = (uint32_t *)(uintptr_t)(*getDmaRegister(CTLBASE) + TX_CHANNEL * 16);
+
+    dmaEnabled |= channels;
+    if (!(channels & TX_CHANNEL_BIT))
+        return;
+    stats.dmaStarts++;
+    memcpy(stats.descriptor, descriptor, sizeof(stats.descriptor));
+    if (descriptor[1] != UART0_BASE + DR || (descriptor[2] & TX_CONTROL_M) != TX_CONTROL)
+    {
+        stats.dmaErrors++;
+        dmaEnabled &= ~TX_CHANNEL_BIT;
+        return;
+    }
+    serviceDma();
+}
+
+static void finishChar(void *context)
+{
+    (void)context;
+    if (stats.txBytes < WIRE_SIZE)
+        wire[stats.txBytes] = shiftData;
+    stats.txBytes++;
+    shifting = false;
+    lineFreeNs = simNow();
+    lineUsed = true;
+    serviceDma();
+    startChar();
+}
+
+// The next input character arrives, the receive time-out restarts
+static void receiveChar(void *context)
+{
+    (void)context;
+    if (rxFifo.count == FIFO_SIZE)
+        stats.rxOverruns++;
+    else
+        pushFifo(&rxFifo, input[inputHead]);
+    inputHead = (inputHead + 1) % INPUT_SIZE;
+    inputCount--;
+    if (rxFifo.count == FIFO_TRIGGER)
+        ris |= UART_RIS_RXRIS;
+    updateUartIrq();
+    if (inputCount > 0)
+        simSchedule(&rxDone, getCharNs());
+    simSchedule(&rxTimeout, getCharNs() * RX_TIMEOUT_BITS / 10);
+}
+
+static void timeOutRx(void *context)
+{
+    (void)context;
+    if (rxFifo.count > 0)
+    {
+        ris |= UART_RIS_RTRIS;
+        updateUartIrq();
+    }
+}
+
+static uint32_t readUart(uint32_t offset, bool peek)
+{
+    uint32_t flags = 0;
+
+    switch (offset)
+    {
+    case DR:
+        if (peek || rxFifo.count == 0)
+            return 0;
+        return popFifo(&rxFifo);
+    case FR:
+        if (txFifo.count == FIFO_SIZE)
+            flags |= UART_FR_TXFF;
+        if (txFifo.count == 0)
+            flags |= UART_FR_TXFE;
+        if (txFifo.count > 0 || shifting)
+            flags |= UART_FR_BUSY;
+        if (rxFifo.count == FIFO_SIZE)
+            flags |= UART_FR_RXFF;
+        if (rxFifo.count == 0)
+            flags |= UART_FR_RXFE;
+        return flags;
+    case RIS:
+        return ris;
+    case MIS:
+        return ris & *getUartRegister(IM);
+    default:
+        return *getUartRegister(offset);
+    }
+}
+
+static void writeUart(uint32_t offset, uint32_t value)
+{
+    switch (offset)
+    {
+    case DR:
+        stats.cpuWrites++;
+        if (txFifo.count == FIFO_SIZE)
+            stats.txOverruns++;
+        else
+            pushFifo(&txFifo, value);
+        startChar();
+        break;
+    case CTL:
+        startChar();
+        break;
+    case IM:
+        updateUartIrq();
+        break;
+    case ICR:
+        ris &= ~value;
+        updateUartIrq();
+        break;
+    case DMACTL:
+        serviceDma();
+        break;
+    }
+}
+
+static uint32_t readDma(uint32_t offset, bool peek)
+{
+    (void)peek;
+    switch (offset)
+    {
+    case ENASET:
+    case ENACLR:
+        return dmaEnabled;
+    case CHIS:
+        return dmaChis;
+    default:
+        return *getDmaRegister(offset);
+    }
+}
+
+static void writeDma(uint32_t offset, uint32_t value)
+{
+    switch (offset)
+    {
+    case ENASET:
+        enableDma(value);
+        break;
+    case ENACLR:
+        dmaEnabled &= ~value;
+        break;
+    case CHIS:
+        dmaChis &= ~value;
+        break;
+    }
+}
+
+static const SIM_DEVICE uartDevice = { UART0_BASE, 0x1000, readUart, writeUart };
+static const SIM_DEVICE dmaDevice = { UDMA_BASE, 0x1000, readDma, writeDma };
+
+void simInitUart(void)
+{
+    txDone.fire = finishChar;
+    rxDone.fire = receiveChar;
+    rxTimeout.fire = timeOutRx;
+    simAddDevice(&uartDevice);
+    simAddDevice(&dmaDevice);
+}
+
+// Clear the captured output and the counters
+void simResetUart(void)
+{
+    memset(&stats, 0, sizeof(stats));
+    lineUsed = false;
+}
+
+// Characters on U0RX, size up to what the input buffer has room for
+void simUartReceive(const char *data, uint16_t size)
+{
+    uint16_t i;
+
+    for (i = 0; i < size && inputCount < INPUT_SIZE; i++)
+        input[(inputHead + inputCount++) % INPUT_SIZE] = data[i];
+    if (!rxDone.scheduled && inputCount > 0)
+        simSchedule(&rxDone, getCharNs());
+}
+
+// Copy up to size characters sent since the reset, returns how many
+uint16_t getSimUartTx(char *data, uint16_t size)
+{
+    uint32_t count = stats.txBytes < WIRE_SIZE ? stats.txBytes : WIRE_SIZE;
+
+    if (count > size)
+        count = size;
+    memcpy(data, wire, count);
+    return count;
+}
+
+void getSimUartStats(SIM_UART_STATS *s)
+{
+    *s = stats;
+}
@@ -0,0 +1,71 @@
+// UART0 Stub
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, built and run by tests/Makefile
+
+//-----------------------------------------------------------------------------
+// Device includes, defines, and assembler directives
+//-----------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "uart0.h"
+
+//-----------------------------------------------------------------------------
+// Global variables
+//-----------------------------------------------------------------------------
+
+char stubTx[STUB_TX_SIZE + 1];
+uint16_t stubTxCount = 0;
+uint16_t stubTxFree = STUB_TX_SIZE;
+uint16_t stubTxErrors = 0;
+
+// Pushed since the last reserve, only counted once committed
+static uint16_t pending = 0;
+static uint16_t reserved = 0;
+
+//-----------------------------------------------------------------------------
+// Subroutines
+//-----------------------------------------------------------------------------
+
+void resetStubTx(uint16_t space)
+{
+    stubTxCount = 0;
+    stubTx[0] = '\0';
+    stubTxFree = space;
+    pending = 0;
+    reserved = 0;
+    stubTxErrors = 0;
+}
+
+bool reserveUart0Tx(uint16_t size)
+{
+    if (size > stubTxFree)
+        return false;
+    reserved = size;
+    pending = 0;
+    return true;
+}
+
+// Pushing more or less than was reserved is a formatter bug
+void pushUart0Tx(char c)
+{
+    if (pending < reserved)
+        stubTx[stubTxCount + pending++] = c;
+    else
+        stubTxErrors++;
+}
+
+void commitUart0Tx(void)
+{
+    if (pending != reserved)
+        stubTxErrors++;
+    stubTxCount += pending;
+    stubTxFree -= pending;
+    stubTx[stubTxCount] = '\0';
+    reserved = 0;
+    pending = 0;
+}
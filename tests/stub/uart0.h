@@ -0,0 +1,36 @@
+// UART0 Stub
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, built and run by tests/Makefile
+// Stands in for UART0.h so fmt.c writes into a host buffer
+
+//-----------------------------------------------------------------------------
+// Device includes, defines, and assembler directives
+//-----------------------------------------------------------------------------
+
+#ifndef UART0_STUB_H_
+#define UART0_STUB_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define STUB_TX_SIZE 256
+
+// Committed text, NUL terminated, the room left in the ring and the number
+// of pushes outside of a reservation
+extern char stubTx[STUB_TX_SIZE + 1];
+extern uint16_t stubTxCount;
+extern uint16_t stubTxFree;
+extern uint16_t stubTxErrors;
+
+void resetStubTx(uint16_t space);
+
+// Same contract as UART0.c: reserve space for a whole value or nothing
+bool reserveUart0Tx(uint16_t size);
+void pushUart0Tx(char c);
+void commitUart0Tx(void);
+
+#endif
@@ -0,0 +1,44 @@
+// Wait Stub
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, built and run by tests/Makefile
+// Waits move simulated time forward, so devices progress and interrupts are
+// taken while the driver waits
+
+//-----------------------------------------------------------------------------
+// Device includes, defines, and assembler directives
+//-----------------------------------------------------------------------------
+
+#include <stdint.h>
+#include "wait.h"
+#include "sim.h"
+
+//-----------------------------------------------------------------------------
+// Subroutines
+//-----------------------------------------------------------------------------
+
+void waitMicrosecond(uint32_t us)
+{
+    simAdvance(us * 1000ULL);
+}
+
+// PRIMASK of the simulated core
+void disableInterrupts(void)
+{
+    simSetPrimask(true);
+}
+
+void enableInterrupts(void)
+{
+    simSetPrimask(false);
+}
+
+// Sleeps to the next device event, a wake without an interrupt is allowed
+// as on the core
+void waitForInterrupt(void)
+{
+    simIdle();
+}
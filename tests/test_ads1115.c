@@ -0,0 +1,386 @@
+// ADS1115 Driver Tests
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, built and run by tests/Makefile against the
+// peripheral simulator (stub/sim.h)
+// Simulated ADS1115s at 0x48 and 0x49 on I2C0 and at 0x48 on I2C1
+
+//-----------------------------------------------------------------------------
+// Device includes, defines, and assembler directives
+//-----------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "check.h"
+#include "sim.h"
+#include "tm4c123gh6pm.h"
+#include "wait.h"
+#include "i2c.h"
+#include "i2c0.h"
+#include "ads1115.h"
+
+#define SAMPLES 16
+
+//-----------------------------------------------------------------------------
+// Global variables
+//-----------------------------------------------------------------------------
+
+static SIM_ADS1115 *adc;
+
+//-----------------------------------------------------------------------------
+// Subroutines
+//-----------------------------------------------------------------------------
+
+static uint32_t getBusBytes(void)
+{
+    SIM_I2C_STATS stats;
+    getSimI2cStats(0, &stats);
+    return stats.bytes;
+}
+
+// Expected conversion code for a voltage, as the device rounds it
+static int16_t getCode(int32_t uv, int32_t fsrUv)
+{
+    return ((int64_t)uv * 32768 + (uv >= 0 ? fsrUv / 2 : -fsrUv / 2)) / fsrUv;
+}
+
+// The setters only touch the shadow, and a write goes out only when the
+// shadow differs from the device
+static void testShadow(void)
+{
+    ADS1115 dev;
+    uint32_t bytes;
+
+    initAds1115(&dev, I2C0_BUS, 0x48);
+    CHECK(adc->configWrites == 1);
+    CHECK(adc->reg[ADS1115_CONFIG] == dev.written);
+
+    bytes = getBusBytes();
+    setAds1115Mux(&dev, ADS1115_MUX_AIN2_AIN3);
+    setAds1115Pga(&dev, ADS1115_PGA_256);
+    setAds1115DataRate(&dev, ADS1115_DR_860);
+    setAds1115Comparator(&dev, ADS1115_COMP_WINDOW, ADS1115_COMP_ACTIVE_HIGH, true, ADS1115_COMP_QUE_2);
+    CHECK(getBusBytes() == bytes);
+
+    CHECK(updateAds1115Config(&dev));
+    CHECK(adc->configWrites == 2);
+    CHECK(adc->reg[ADS1115_CONFIG] == dev.config);
+    CHECK(getBusBytes() - bytes == 4);
+
+    bytes = getBusBytes();
+    CHECK(!updateAds1115Config(&dev));
+    setAds1115Pga(&dev, ADS1115_PGA_256);
+    CHECK(!updateAds1115Config(&dev));
+    CHECK(getBusBytes() == bytes);
+    CHECK(adc->configWrites == 2);
+    CHECK(adc->configReads == 0);
+}
+
+// Alternate two channels the way main() used to, reading the config back
+// before each write, against the shadowed driver
+static void testTraffic(void)
+{
+    static const uint8_t mux[2] = { ADS1115_MUX_AIN0_GND, ADS1115_MUX_AIN2_AIN3 };
+    static const uint8_t pga[2] = { ADS1115_PGA_2048, ADS1115_PGA_256 };
+    static const int32_t fsrUv[2] = { 2048000, 256000 };
+    uint32_t waitUs = getAds1115ConversionUs(ADS1115_DR_128);
+    uint8_t config[2], data[2];
+    uint32_t bytes, oldBytes, newBytes, devBytes;
+    uint32_t reads = adc->configReads;
+    ADS1115 dev;
+    int16_t result;
+    bool ok = true;
+    uint8_t i, c;
+
+    adc->ainUv[0] = 750000;
+    adc->ainUv[2] = 1000;
+    adc->ainUv[3] = 0;
+
+    // read-modify-write of the config, then the result
+    bytes = getBusBytes();
+    for (i = 0; i < SAMPLES; i++)
+    {
+        c = i & 1;
+        readI2c0Registers(0x48, ADS1115_CONFIG, config, 2);
+        config[0] = (config[0] & ~0x7E) | (mux[c] << 4) | (pga[c] << 1) | 0x81;
+        writeI2c0Registers(0x48, ADS1115_CONFIG, config, 2);
+        waitMicrosecond(waitUs);
+        readI2c0Registers(0x48, ADS1115_CONVERSION, data, 2);
+        ok &= (int16_t)((data[0] << 8) | data[1]) == getCode(adc->ainUv[c * 2] - (c ? adc->ainUv[3] : 0), fsrUv[c]);
+    }
+    oldBytes = getBusBytes() - bytes;
+    CHECK(ok);
+    CHECK(adc->configReads - reads == SAMPLES);
+
+    // shadowed, the conversion start carries the channel switch
+    initAds1115(&dev, I2C0_BUS, 0x48);
+    reads = adc->configReads;
+    bytes = getBusBytes();
+    devBytes = getAds1115BusBytes(&dev);
+    for (i = 0; i < SAMPLES; i++)
+    {
+        c = i & 1;
+        setAds1115Mux(&dev, mux[c]);
+        setAds1115Pga(&dev, pga[c]);
+        setAds1115Mode(&dev, ADS1115_MODE_SINGLE_SHOT);
+        startAds1115Conversion(&dev);
+        waitMicrosecond(waitUs);
+        result = readAds1115Conversion(&dev);
+        ok &= result == getCode(adc->ainUv[c * 2] - (c ? adc->ainUv[3] : 0), fsrUv[c]);
+    }
+    newBytes = getBusBytes() - bytes;
+    CHECK(ok);
+    CHECK(adc->configReads == reads);
+    CHECK(getAds1115BusBytes(&dev) - devBytes == newBytes);
+
+    printf("I2C bytes per sample: read-modify-write %u, shadowed %u\n",
+           (unsigned)(oldBytes / SAMPLES), (unsigned)(newBytes / SAMPLES));
+    CHECK(oldBytes == SAMPLES * 14);
+    CHECK(newBytes == SAMPLES * 9);
+}
+
+// Time from the end of a conversion until the driver has the result, for
+// the fixed 10 ms wait of the original loop and for the ALERT/RDY wait,
+// which sleeps until the edge instead of polling
+static void testReadyLatency(void)
+{
+    SIM_COUNTS before, after;
+    uint64_t fixedNs, readyNs, startNs;
+    uint32_t conversions;
+    ADS1115 dev;
+
+    initAds1115(&dev, I2C0_BUS, 0x48);
+    enableAds1115ReadyInterrupt(&dev);
+    setAds1115Mode(&dev, ADS1115_MODE_SINGLE_SHOT);
+    setAds1115DataRate(&dev, ADS1115_DR_128);
+
+    startAds1115Conversion(&dev);
+    waitMicrosecond(10000);
+    fixedNs = simNow() - adc->readyNs;
+
+    clearAds1115Ready();
+    conversions = adc->conversions;
+    startAds1115Conversion(&dev);
+    getSimCounts(&before);
+    CHECK(waitAds1115Ready(getAds1115ConversionUs(ADS1115_DR_128)));
+    getSimCounts(&after);
+    readyNs = simNow() - adc->readyNs;
+    CHECK(adc->conversions == conversions + 1);
+    CHECK(readyNs < 2000);
+    CHECK(after.reads + after.writes - before.reads - before.writes < 10);
+
+    printf("result latency: fixed 10 ms wait %.1f us, ALERT/RDY %.1f us\n", fixedNs / 1000.0, readyNs / 1000.0);
+    CHECK(readyNs * 100 < fixedNs);
+
+    // a device that never signals times out on Timer 2A
+    setAds1115Comparator(&dev, ADS1115_COMP_TRADITIONAL, ADS1115_COMP_ACTIVE_HIGH, false, ADS1115_COMP_QUE_DISABLE);
+    updateAds1115Config(&dev);
+    startAds1115Conversion(&dev);
+    startNs = simNow();
+    CHECK(!waitAds1115Ready(2000));
+    CHECK_NEAR((simNow() - startNs) / 1000.0, 2000, 5);
+}
+
+// Samples per second of one channel through scanAds1115, waiting on
+// ALERT/RDY or for the worst-case conversion time of the data rate
+static double getSampleRate(ADS1115 *dev, ADS1115_DR dr, uint8_t discard)
+{
+    ADS1115_CHANNEL ch = { ADS1115_MUX_AIN0_GND, ADS1115_PGA_2048, dr, discard };
+    const ADS1115_CHANNEL *chs[1] = { &ch };
+    ADS1115 *devs[1] = { dev };
+    uint64_t startNs = simNow();
+    int16_t result;
+    bool ok = true;
+    uint8_t i;
+
+    for (i = 0; i < SAMPLES; i++)
+    {
+        ok &= scanAds1115(devs, chs, &result, 1);
+        ok &= result == getCode(adc->ainUv[0], 2048000);
+    }
+    CHECK(ok);
+    return SAMPLES * 1e9 / (simNow() - startNs);
+}
+
+// The wait follows the data rate, where the original loop waited 10 ms for
+// every rate
+static void testSampleRate(void)
+{
+    static const ADS1115_DR rates[] = { ADS1115_DR_8, ADS1115_DR_128, ADS1115_DR_860 };
+    static const double sps[] = { 8, 128, 860 };
+    double ready, fixed, settled;
+    ADS1115 dev;
+    uint8_t i;
+
+    adc->ainUv[0] = 750000;
+    initAds1115(&dev, I2C0_BUS, 0x48);
+    for (i = 0; i < 3; i++)
+    {
+        dev.readyInterrupt = false;
+        fixed = getSampleRate(&dev, rates[i], 0);
+        enableAds1115ReadyInterrupt(&dev);
+        ready = getSampleRate(&dev, rates[i], 0);
+        settled = getSampleRate(&dev, rates[i], 1);
+        printf("%3.0f SPS: %6.1f samples/s on ALERT/RDY, %6.1f on the conversion time, %6.1f discarding one\n",
+               sps[i], ready, fixed, settled);
+        CHECK(ready > 0.8 * sps[i] && ready <= sps[i]);
+        CHECK(fixed > 0.75 * sps[i] && fixed <= ready);
+        CHECK_NEAR(settled, ready / 2, ready * 0.05);
+    }
+}
+
+// A nacked start or collect is retried inside the scan, a device that keeps
+// nacking fails it
+static void testScanRetry(void)
+{
+    ADS1115_CHANNEL ch = { ADS1115_MUX_AIN0_GND, ADS1115_PGA_2048, ADS1115_DR_860, 0 };
+    const ADS1115_CHANNEL *chs[1] = { &ch };
+    ADS1115 *devs[1];
+    ADS1115 dev;
+    I2C_STATS stats;
+    int16_t result;
+
+    adc->ainUv[0] = 750000;
+    initAds1115(&dev, I2C0_BUS, 0x48);
+    enableAds1115ReadyInterrupt(&dev);
+    devs[0] = &dev;
+
+    resetI2c0Stats();
+    adc->nackAddress = 1;
+    CHECK(scanAds1115(devs, chs, &result, 1));
+    CHECK(result == getCode(adc->ainUv[0], 2048000));
+    adc->nackData = 1;
+    CHECK(scanAds1115(devs, chs, &result, 1));
+    getI2c0Stats(&stats);
+    CHECK(stats.retries == 2);
+
+    adc->nackAddress = I2C_RETRIES + 1;
+    CHECK(!scanAds1115(devs, chs, &result, 1));
+    adc->nackAddress = 0;
+    CHECK(scanAds1115(devs, chs, &result, 1));
+}
+
+// A scan behind a full I2C0 queue waits for room instead of recovering the
+// bus under the queued transfers
+static void testScanQueueFull(void)
+{
+    ADS1115_CHANNEL ch = { ADS1115_MUX_AIN0_GND, ADS1115_PGA_2048, ADS1115_DR_860, 0 };
+    const ADS1115_CHANNEL *chs[1] = { &ch };
+    I2C_TRANSACTION poll[I2C_QUEUE_SIZE];
+    I2C_BATCH b[I2C_QUEUE_SIZE];
+    ADS1115 *devs[1];
+    ADS1115 dev;
+    I2C_STATS stats;
+    int16_t result;
+    bool ok = true;
+    uint8_t i;
+
+    initAds1115(&dev, I2C0_BUS, 0x48);
+    enableAds1115ReadyInterrupt(&dev);
+    devs[0] = &dev;
+    resetI2c0Stats();
+    for (i = 0; i < I2C_QUEUE_SIZE; i++)
+    {
+        poll[i].add = 0x48;
+        poll[i].writeSize = 0;
+        poll[i].readSize = 0;
+        b[i].t = &poll[i];
+        b[i].count = 1;
+        b[i].callback = 0;
+        CHECK(queueI2c0Batch(&b[i]));
+    }
+    CHECK(scanAds1115(devs, chs, &result, 1));
+    CHECK(result == getCode(adc->ainUv[0], 2048000));
+    for (i = 0; i < I2C_QUEUE_SIZE; i++)
+        ok &= b[i].status == I2C_DONE;
+    CHECK(ok);
+
+    getI2c0Stats(&stats);
+    CHECK(stats.errors[I2C_QUEUE_FULL] == 1);
+    CHECK(stats.retries == 1 && stats.recoveries == 0);
+}
+
+// Time of SAMPLES scans of two devices and the time both buses were busy
+static uint64_t getScanNs(ADS1115 *devs[], uint64_t *overlapNs)
+{
+    ADS1115_CHANNEL ch = { ADS1115_MUX_AIN0_GND, ADS1115_PGA_2048, ADS1115_DR_860, 0 };
+    const ADS1115_CHANNEL *chs[2] = { &ch, &ch };
+    uint64_t startNs = simNow();
+    uint64_t startOverlapNs = getSimI2cOverlapNs();
+    int16_t result[2];
+    bool ok = true;
+    uint8_t i;
+
+    for (i = 0; i < SAMPLES; i++)
+    {
+        ok &= scanAds1115(devs, chs, result, 2);
+        ok &= result[0] == getCode(adc->ainUv[0], 2048000);
+        ok &= result[1] == getCode(devs[1]->bus == I2C0_BUS ? 500000 : 250000, 2048000);
+    }
+    CHECK(ok);
+    *overlapNs = getSimI2cOverlapNs() - startOverlapNs;
+    return simNow() - startNs;
+}
+
+// Two devices on I2C0 take turns on its queue, with one of them on I2C1 the
+// transfers of a scan overlap and the time saved is the time both buses were
+// busy at once
+static void testMultiBus(void)
+{
+    SIM_ADS1115 *neighbor = simAddAds1115(0, 0x49);
+    SIM_ADS1115 *remote = simAddAds1115(1, 0x48);
+    ADS1115 dev[3];
+    ADS1115 *sameBus[2] = { &dev[0], &dev[1] };
+    ADS1115 *twoBuses[2] = { &dev[0], &dev[2] };
+    uint64_t sameNs, twoNs, sameOverlapNs, twoOverlapNs;
+    uint8_t i;
+
+    adc->ainUv[0] = 750000;
+    neighbor->ainUv[0] = 500000;
+    remote->ainUv[0] = 250000;
+    initI2c(&i2cBus[1], 40000000, I2C_FAST_HZ);
+    initAds1115(&dev[0], I2C0_BUS, 0x48);
+    initAds1115(&dev[1], I2C0_BUS, 0x49);
+    initAds1115(&dev[2], &i2cBus[1], 0x48);
+    for (i = 0; i < 3; i++)
+        enableAds1115ReadyInterrupt(&dev[i]);
+
+    sameNs = getScanNs(sameBus, &sameOverlapNs);
+    twoNs = getScanNs(twoBuses, &twoOverlapNs);
+    printf("two devices at 860 SPS: %.1f us/scan on one bus, %.1f us/scan on two, %.1f us/scan overlapped\n",
+           sameNs / 1000.0 / SAMPLES, twoNs / 1000.0 / SAMPLES, twoOverlapNs / 1000.0 / SAMPLES);
+    CHECK(sameOverlapNs == 0);
+    CHECK(twoOverlapNs > 0);
+    CHECK(twoNs < sameNs);
+    CHECK(sameNs - twoNs >= twoOverlapNs * 8 / 10);
+}
+
+//-----------------------------------------------------------------------------
+// Main
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    (void)argc;
+    simInit();
+    simInitI2c();
+    simInitTimers();
+    simVector(INT_I2C0, i2c0Isr);
+    simVector(INT_I2C1, i2c1Isr);
+    simVector(INT_GPIOB, ads1115AlertIsr);
+    simVector(INT_TIMER2A, ads1115TimerIsr);
+    adc = simAddAds1115(0, 0x48);
+    initI2c0(40000000, I2C_FAST_HZ);
+
+    testShadow();
+    testTraffic();
+    testReadyLatency();
+    testSampleRate();
+    testScanRetry();
+    testScanQueueFull();
+    testMultiBus();
+    return checkResult(argv[0]);
+}
@@ -0,0 +1,151 @@
+// Formatter Tests
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, built and run by tests/Makefile
+// fmt.c writes into the UART0 stub, results are compared with snprintf
+
+//-----------------------------------------------------------------------------
+// Device includes, defines, and assembler directives
+//-----------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "check.h"
+#include "uart0.h"
+#include "fmt.h"
+
+#define RANDOM_VALUES 100000
+
+static const uint32_t edges[] =
+{
+    0, 1, 9, 10, 99, 100, 999, 1000, 9999, 10000, 99999, 100000, 999999,
+    1000000, 9999999, 10000000, 99999999, 100000000, 999999999, 1000000000,
+    0x7FFFFFFF, 0x80000000, 0x80000001, 0xFFFFFFFE, 0xFFFFFFFF
+};
+
+#define EDGE_COUNT (sizeof(edges) / sizeof(edges[0]))
+
+//-----------------------------------------------------------------------------
+// Subroutines
+//-----------------------------------------------------------------------------
+
+static uint32_t randomU32(void)
+{
+    return ((uint32_t)rand() << 16) ^ (uint32_t)rand();
+}
+
+// Reference for fmt_fixed
+static void fixedString(char *s, size_t size, int32_t value, uint8_t decimals)
+{
+    uint32_t magnitude = value < 0 ? 0u - (uint32_t)value : (uint32_t)value;
+    uint32_t scale = 1;
+    uint8_t i;
+
+    decimals %= 10;
+    for (i = 0; i < decimals; i++)
+        scale *= 10;
+    if (decimals)
+        snprintf(s, size, "%s%u.%0*u", value < 0 ? "-" : "", magnitude / scale, decimals, magnitude % scale);
+    else
+        snprintf(s, size, "%s%u", value < 0 ? "-" : "", magnitude);
+}
+
+// Format one value and compare with the expected text
+static void checkValue(uint32_t value, uint8_t decimals)
+{
+    char expected[32];
+
+    resetStubTx(STUB_TX_SIZE);
+    fmt_u32(value);
+    snprintf(expected, sizeof(expected), "%u", value);
+    CHECK(strcmp(stubTx, expected) == 0);
+
+    resetStubTx(STUB_TX_SIZE);
+    fmt_i32((int32_t)value);
+    snprintf(expected, sizeof(expected), "%d", (int32_t)value);
+    CHECK(strcmp(stubTx, expected) == 0);
+
+    resetStubTx(STUB_TX_SIZE);
+    fmt_u32_hex(value);
+    snprintf(expected, sizeof(expected), "%X", value);
+    CHECK(strcmp(stubTx, expected) == 0);
+
+    resetStubTx(STUB_TX_SIZE);
+    fmt_fixed((int32_t)value, decimals);
+    fixedString(expected, sizeof(expected), (int32_t)value, decimals);
+    CHECK(strcmp(stubTx, expected) == 0);
+    CHECK(stubTxErrors == 0);
+}
+
+static void testValues(void)
+{
+    uint32_t i;
+    uint8_t decimals;
+
+    for (i = 0; i < EDGE_COUNT; i++)
+    {
+        for (decimals = 0; decimals <= 9; decimals++)
+        {
+            checkValue(edges[i], decimals);
+            checkValue(0u - edges[i], decimals);
+        }
+    }
+    for (i = 0; i < RANDOM_VALUES; i++)
+        checkValue(randomU32() >> (rand() % 32), rand() % 10);
+}
+
+// Temperatures as the firmware prints them
+static void testFixed(void)
+{
+    resetStubTx(STUB_TX_SIZE);
+    fmt_fixed(-5, 2);
+    fmt_fixed(2512, 1);
+    fmt_fixed(-12345, 2);
+    fmt_fixed(7, 0);
+    CHECK(strcmp(stubTx, "-0.05251.2-123.457") == 0);
+
+    // more than 9 decimals is limited to 9
+    resetStubTx(STUB_TX_SIZE);
+    fmt_fixed(1, 12);
+    CHECK(strcmp(stubTx, "0.000000001") == 0);
+}
+
+// A value that does not fit is dropped whole, never cut
+static void testFull(void)
+{
+    resetStubTx(3);
+    fmt_i32(-1234);
+    CHECK(stubTxCount == 0);
+    fmt_u32(123);
+    CHECK(strcmp(stubTx, "123") == 0);
+    fmt_u32_hex(0xA);
+    CHECK(strcmp(stubTx, "123") == 0);
+
+    resetStubTx(5);
+    fmt_fixed(-1234, 2);
+    CHECK(stubTxCount == 0);
+    fmt_fixed(-1234, 1);
+    CHECK(stubTxCount == 0);
+    fmt_fixed(1234, 1);
+    CHECK(strcmp(stubTx, "123.4") == 0);
+    CHECK(stubTxErrors == 0);
+}
+
+//-----------------------------------------------------------------------------
+// Main
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    (void)argc;
+    srand(1);
+    testValues();
+    testFixed();
+    testFull();
+    return checkResult(argv[0]);
+}
@@ -0,0 +1,328 @@
+// I2C Driver Tests
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, built and run by tests/Makefile against the
+// peripheral simulator (stub/sim.h)
+// Simulated ADS1115s at 0x48 on I2C0, one of them given faults
+
+//-----------------------------------------------------------------------------
+// Device includes, defines, and assembler directives
+//-----------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "check.h"
+#include "sim.h"
+#include "tm4c123gh6pm.h"
+#include "wait.h"
+#include "i2c.h"
+#include "i2c0.h"
+
+#define BATCHES 3
+
+// Bus rates and the TPR, SCL rate and ADS1115 sample time they give at
+// 40 MHz, a sample is a config write and a conversion read in 86 SCL periods,
+// high-speed sends a master code at 400 kHz before each of its two STARTs
+typedef struct _SPEED
+{
+    uint32_t sclHz;
+    uint8_t tpr;
+    uint32_t actualHz;
+    double sampleUs;
+} SPEED;
+
+static const SPEED speeds[] =
+{
+    { I2C_STANDARD_HZ, 19, 100000,  860.0 },
+    { I2C_FAST_HZ,     4,  400000,  215.0 },
+    { I2C_FM_PLUS_HZ,  1,  1000000, 86.0 },
+    { I2C_HS_HZ,       1,  3333333, 86 * 0.3 + 2 * 22.5 },
+};
+
+#define SPEED_COUNT (sizeof(speeds) / sizeof(speeds[0]))
+
+//-----------------------------------------------------------------------------
+// Global variables
+//-----------------------------------------------------------------------------
+
+// Config write of an ADS1115, 4 bytes on the bus with the address
+static const uint8_t config[3] = { 1, 0x85, 0x83 };
+static const uint8_t pointer = 0;
+
+static SIM_ADS1115 *adc;
+
+//-----------------------------------------------------------------------------
+// Subroutines
+//-----------------------------------------------------------------------------
+
+static void initConfigBatch(I2C_BATCH *b, I2C_TRANSACTION t[], uint8_t count, uint8_t add)
+{
+    uint8_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        t[i].add = add;
+        t[i].writeData = config;
+        t[i].writeSize = 3;
+        t[i].readData = 0;
+        t[i].readSize = 0;
+    }
+    b->t = t;
+    b->count = count;
+    b->callback = 0;
+}
+
+// TPR and SCL rate from the system clock, and the bus time of one ADS1115
+// sample at each rate
+static void testSpeeds(void)
+{
+    I2C_TRANSACTION t[2];
+    I2C_BATCH b;
+    uint8_t data[2];
+    uint32_t actualHz;
+    uint64_t startNs;
+    double us;
+    uint8_t i;
+
+    printf("SCL rate   TPR  actual Hz  us/sample\n");
+    for (i = 0; i < SPEED_COUNT; i++)
+    {
+        actualHz = initI2c0(40000000, speeds[i].sclHz);
+        CHECK(actualHz == speeds[i].actualHz);
+        CHECK((I2C0_MTPR_R & I2C_MTPR_TPR_M) == speeds[i].tpr);
+        CHECK(((I2C0_MTPR_R & I2C_MTPR_HS) != 0) == (speeds[i].sclHz > I2C_FM_PLUS_HZ));
+
+        initConfigBatch(&b, t, 2, 0x48);
+        t[1].writeData = &pointer;
+        t[1].writeSize = 1;
+        t[1].readData = data;
+        t[1].readSize = 2;
+        startNs = simNow();
+        CHECK(queueI2c0Batch(&b));
+        CHECK(waitI2cBatch(&b) == I2C_DONE);
+        us = (simNow() - startNs) / 1000.0;
+        printf("%8u  %4u  %9u  %9.1f\n", (unsigned)speeds[i].sclHz, (unsigned)speeds[i].tpr, (unsigned)actualHz, us);
+
+        // the interrupt handler adds a few register accesses per byte and
+        // waitI2cBatch looks every 10 us
+        CHECK(us >= speeds[i].sampleUs && us < speeds[i].sampleUs * 1.05 + 10);
+    }
+
+    // no rate is standard mode, not a divide by zero
+    CHECK(initI2c0(40000000, 0) == 100000);
+    CHECK((I2C0_MTPR_R & I2C_MTPR_TPR_M) == 19);
+}
+
+// Utilization from the byte count, in 0.01%
+static void testUtilizationArithmetic(void)
+{
+    initI2c0(40000000, I2C_FAST_HZ);
+    resetI2c0Stats();
+    CHECK(I2C0_BUS->byteNs == 22500);                   // 9 SCL periods at 400 kHz
+
+    CHECK(getI2c0Utilization(0) == 0);
+    CHECK(getI2c0Utilization(1000) == 0);
+    I2C0_BUS->stats.busBytes = 100;                     // 2.25 ms of bus time
+    CHECK(getI2c0Utilization(10000) == 2250);
+    CHECK(getI2c0Utilization(2250) == 10000);
+    CHECK(getI2c0Utilization(1000) == 10000);           // more bus time than window
+    CHECK(getI2c0Utilization(3000000) == 7);            // rounded down
+    I2C0_BUS->stats.busBytes = 100000000;               // 64 bit product
+    CHECK(getI2c0Utilization(UINT32_MAX) == 5238);
+    CHECK(getI2c0Utilization(2250000000u) == 10000);
+    resetI2c0Stats();
+}
+
+// Queue depth and utilization of batches against the simulated bus time
+static void testQueueCounters(void)
+{
+    I2C_TRANSACTION t[BATCHES][2];
+    I2C_BATCH b[BATCHES];
+    SIM_I2C_STATS before, after;
+    I2C_STATS stats;
+    uint64_t startNs;
+    uint32_t elapsedUs;
+    double simUtilization;
+    bool ok = true;
+    uint8_t i;
+
+    initI2c0(40000000, I2C_FAST_HZ);
+    resetI2c0Stats();
+    getSimI2cStats(0, &before);
+    startNs = simNow();
+    for (i = 0; i < BATCHES; i++)
+    {
+        initConfigBatch(&b[i], t[i], 2, 0x48);
+        CHECK(queueI2c0Batch(&b[i]));
+    }
+    CHECK(getI2c0QueueDepth() == BATCHES);
+    for (i = 0; i < BATCHES; i++)
+        ok &= waitI2cBatch(&b[i]) == I2C_DONE;
+    CHECK(ok);
+    CHECK(getI2c0QueueDepth() == 0);
+
+    // idle for as long again
+    waitMicrosecond((simNow() - startNs) / 1000);
+    elapsedUs = (simNow() - startNs) / 1000;
+    getSimI2cStats(0, &after);
+    getI2c0Stats(&stats);
+    CHECK(stats.maxQueueDepth == BATCHES);
+    CHECK(stats.batches == BATCHES);
+    CHECK(stats.transactions == BATCHES * 2);
+    CHECK(stats.busBytes == BATCHES * 2 * 4);
+    CHECK(stats.busBytes == after.bytes - before.bytes);
+
+    // the driver counts 9 SCL periods a byte, the bus also takes the START
+    // and STOP bits
+    simUtilization = (after.busyNs - before.busyNs) * 10.0 / elapsedUs;
+    printf("I2C0 utilization: driver %.2f%%, simulated bus %.2f%%\n",
+           getI2c0Utilization(elapsedUs) / 100.0, simUtilization / 100.0);
+    CHECK_NEAR(getI2c0Utilization(elapsedUs), simUtilization, simUtilization * 0.1);
+    CHECK_NEAR(getI2c0Utilization(elapsedUs), 5000, 500);
+
+    resetI2c0Stats();
+    getI2c0Stats(&stats);
+    CHECK(stats.maxQueueDepth == 0 && stats.busBytes == 0);
+}
+
+// Run a config write with retries, returning its status and the time spent
+// off the bus, which is the backoff plus the polling of waitI2cBatch
+static I2C_STATUS runFaultBatch(I2C_STATS *stats, uint32_t *idleUs)
+{
+    I2C_TRANSACTION t;
+    I2C_BATCH b;
+    SIM_I2C_STATS before, after;
+    uint64_t startNs;
+    I2C_STATUS status;
+
+    resetI2c0Stats();
+    getSimI2cStats(0, &before);
+    initConfigBatch(&b, &t, 1, 0x48);
+    startNs = simNow();
+    status = runI2cBatch(I2C0_BUS, &b, I2C_RETRIES);
+    getSimI2cStats(0, &after);
+    getI2c0Stats(stats);
+    *idleUs = (simNow() - startNs - (after.busyNs - before.busyNs)) / 1000;
+    return status;
+}
+
+// Address and data nacks are retried after 100, 200 and 400 us, without a
+// bus recovery since the master ends a nacked transfer with a STOP
+static void testNackRetry(void)
+{
+    I2C_STATS stats;
+    uint32_t idleUs;
+
+    initI2c0(40000000, I2C_FAST_HZ);
+    adc->nackAddress = 2;
+    CHECK(runFaultBatch(&stats, &idleUs) == I2C_DONE);
+    CHECK(stats.retries == 2 && stats.recoveries == 0);
+    CHECK(stats.errors[I2C_ADDR_NACK] == 2);
+    CHECK(idleUs >= 300 && idleUs < 300 + 3 * 10 + 5);
+
+    adc->nackData = 1;
+    CHECK(runFaultBatch(&stats, &idleUs) == I2C_DONE);
+    CHECK(stats.retries == 1 && stats.recoveries == 0);
+    CHECK(stats.errors[I2C_DATA_NACK] == 1);
+    CHECK(idleUs >= 100 && idleUs < 100 + 2 * 10 + 5);
+
+    // a slave that never answers gives up after I2C_RETRIES
+    adc->nackAddress = I2C_RETRIES + 1;
+    CHECK(runFaultBatch(&stats, &idleUs) == I2C_ADDR_NACK);
+    CHECK(stats.retries == I2C_RETRIES && stats.errors[I2C_ADDR_NACK] == I2C_RETRIES + 1);
+    CHECK(idleUs >= 700 && idleUs < 700 + 4 * 10 + 5);
+    printf("nack retries: backoff and polling %u us for 3 retries\n", (unsigned)idleUs);
+    CHECK(adc->nackAddress == 0);
+}
+
+// A slave stretching the clock past the batch time-out fails the wait, which
+// recovers the bus, and the retry goes through
+static void testTimeoutRetry(void)
+{
+    I2C_STATS stats;
+    uint32_t idleUs;
+    uint32_t writes = adc->configWrites;
+
+    initI2c0(40000000, I2C_FAST_HZ);
+    adc->stretchCount = 1;
+    adc->stretchNs = 20000000;
+    CHECK(runFaultBatch(&stats, &idleUs) == I2C_DONE);
+    CHECK(stats.errors[I2C_TIMEOUT] == 1);
+    CHECK(stats.retries == 1 && stats.recoveries == 1);
+    CHECK(adc->configWrites == writes + 1);
+    CHECK((I2C0_MCS_R & I2C_MCS_BUSBSY) == 0);
+}
+
+// A slave holding SDA low makes the bus busy until the recovery clocks it
+// free, then the retry goes through
+static void testHeldSdaRetry(void)
+{
+    SIM_I2C_STATS before, after;
+    I2C_STATS stats;
+    uint32_t idleUs;
+
+    initI2c0(40000000, I2C_FAST_HZ);
+    getSimI2cStats(0, &before);
+    simHoldSda(0, 5);
+    CHECK(runFaultBatch(&stats, &idleUs) == I2C_DONE);
+    getSimI2cStats(0, &after);
+    CHECK(stats.retries == 1 && stats.recoveries == 1);
+    CHECK(after.sclPulses - before.sclPulses == 5 + 1);  // 5 to free SDA, 1 for the STOP
+    CHECK(idleUs >= 100);
+    CHECK((I2C0_MCS_R & I2C_MCS_BUSBSY) == 0);
+}
+
+// A full queue fails a batch with I2C_QUEUE_FULL and no bus recovery, the
+// retry waits for room and leaves the queued batches to complete
+static void testQueueFull(void)
+{
+    I2C_TRANSACTION t[I2C_QUEUE_SIZE + 1];
+    I2C_BATCH b[I2C_QUEUE_SIZE + 1];
+    I2C_STATS stats;
+    bool ok = true;
+    uint8_t i;
+
+    initI2c0(40000000, I2C_FAST_HZ);
+    resetI2c0Stats();
+    for (i = 0; i <= I2C_QUEUE_SIZE; i++)
+        initConfigBatch(&b[i], &t[i], 1, 0x48);
+    for (i = 0; i < I2C_QUEUE_SIZE; i++)
+        CHECK(queueI2c0Batch(&b[i]));
+    CHECK(!queueI2c0Batch(&b[I2C_QUEUE_SIZE]));
+    CHECK(runI2cBatch(I2C0_BUS, &b[I2C_QUEUE_SIZE], 0) == I2C_QUEUE_FULL);
+    CHECK(runI2cBatch(I2C0_BUS, &b[I2C_QUEUE_SIZE], I2C_RETRIES) == I2C_DONE);
+    for (i = 0; i < I2C_QUEUE_SIZE; i++)
+        ok &= waitI2cBatch(&b[i]) == I2C_DONE;
+    CHECK(ok);
+
+    getI2c0Stats(&stats);
+    CHECK(stats.errors[I2C_QUEUE_FULL] == 3);
+    CHECK(stats.retries == 1 && stats.recoveries == 0);
+    CHECK(stats.batches == I2C_QUEUE_SIZE + 1);
+}
+
+//-----------------------------------------------------------------------------
+// Main
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    (void)argc;
+    simInit();
+    simInitI2c();
+    simInitTimers();
+    simVector(INT_I2C0, i2c0Isr);
+    adc = simAddAds1115(0, 0x48);
+
+    testSpeeds();
+    testUtilizationArithmetic();
+    testQueueCounters();
+    testNackRetry();
+    testTimeoutRetry();
+    testHeldSdaRetry();
+    testQueueFull();
+    return checkResult(argv[0]);
+}
@@ -0,0 +1,294 @@
+// I2C Master State Machine Tests
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, built and run by tests/Makefile
+// The I2C master and one register-file slave are simulated at the level of
+// the I2CMSA/I2CMDR/I2CMCS accesses the state machine asks for
+
+//-----------------------------------------------------------------------------
+// Device includes, defines, and assembler directives
+//-----------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "check.h"
+#include "i2c_fsm.h"
+
+#define SLAVE_ADD 0x48
+#define NO_NACK   0xFF
+#define MAX_STEPS 64
+
+// Simulated master and slave
+// The slave takes the first written byte as its register pointer, stores
+// the rest from there, and reads from the pointer on
+typedef struct _SIM
+{
+    uint8_t msa;
+    uint8_t mdr;
+    bool busOwned;                                      // START sent and no STOP yet
+    bool reading;
+    uint8_t starts;
+    uint8_t stops;
+    uint8_t hsStarts;                                   // STARTs with the HS bit
+    uint8_t add;
+    uint8_t mem[256];
+    uint8_t pointer;
+    bool pointerSet;
+    uint8_t written;                                    // data bytes acked so far
+    uint8_t nackAt;                                     // data byte the slave nacks
+    bool loseArbitration;
+} SIM;
+
+static uint8_t callbacks;
+
+//-----------------------------------------------------------------------------
+// Subroutines
+//-----------------------------------------------------------------------------
+
+static void initSim(SIM *s)
+{
+    uint16_t i;
+
+    memset(s, 0, sizeof(*s));
+    s->add = SLAVE_ADD;
+    s->nackAt = NO_NACK;
+    for (i = 0; i < 256; i++)
+        s->mem[i] = i ^ 0xA5;
+}
+
+static void stopSim(SIM *s)
+{
+    s->busOwned = false;
+    s->stops++;
+}
+
+// Perform one access and return the I2CMCS status the master would show
+static uint8_t applySim(SIM *s, const I2C_FSM_CMD *cmd)
+{
+    if (cmd->flags & I2C_FSM_SET_MSA)
+        s->msa = cmd->msa;
+    if (cmd->flags & I2C_FSM_SET_MDR)
+        s->mdr = cmd->mdr;
+
+    if (!(cmd->mcs & I2C_FSM_RUN))
+    {
+        if (cmd->mcs & I2C_FSM_STOP)
+            stopSim(s);
+        return 0;
+    }
+
+    if (cmd->mcs & I2C_FSM_START)
+    {
+        s->starts++;
+        if (cmd->mcs & I2C_FSM_HS)
+            s->hsStarts++;
+        if (s->loseArbitration)
+        {
+            s->busOwned = false;
+            return I2C_FSM_ERROR | I2C_FSM_ARBLST;
+        }
+        s->busOwned = true;
+        s->reading = s->msa & 1;
+        if (!s->reading)
+            s->pointerSet = false;
+        if ((s->msa >> 1) != s->add)
+        {
+            if (cmd->mcs & I2C_FSM_STOP)
+                stopSim(s);
+            return I2C_FSM_ERROR | I2C_FSM_ADRACK;
+        }
+    }
+    CHECK(s->busOwned);
+
+    if (s->reading)
+        s->mdr = s->mem[s->pointer++];
+    else if (s->written++ == s->nackAt)
+    {
+        if (cmd->mcs & I2C_FSM_STOP)
+            stopSim(s);
+        return I2C_FSM_ERROR | I2C_FSM_DATACK;
+    }
+    else if (!s->pointerSet)
+    {
+        s->pointer = s->mdr;
+        s->pointerSet = true;
+    }
+    else
+        s->mem[s->pointer++] = s->mdr;
+
+    if (cmd->mcs & I2C_FSM_STOP)
+        stopSim(s);
+    return 0;
+}
+
+static void countCallback(I2C_TRANSACTION *t)
+{
+    (void)t;
+    callbacks++;
+}
+
+// Run a transaction to completion the way the interrupt handler does
+// Every transaction has to leave the bus released and call back once
+static I2C_STATUS runSim(SIM *s, I2C_TRANSACTION *t, uint8_t startFlags)
+{
+    I2C_FSM fsm = { 0 };
+    I2C_FSM_CMD cmd;
+    uint8_t mcs;
+    uint8_t steps = 0;
+
+    callbacks = 0;
+    t->callback = countCallback;
+    fsm.startFlags = startFlags;
+    i2cFsmStart(&fsm, t, &cmd);
+    CHECK(isI2cFsmBusy(&fsm));
+    do
+    {
+        mcs = applySim(s, &cmd);
+    } while (i2cFsmStep(&fsm, mcs, s->mdr, &cmd) && ++steps < MAX_STEPS);
+    CHECK(steps < MAX_STEPS);
+    CHECK(t->status != I2C_BUSY);
+    i2cFsmComplete(&fsm);
+    CHECK(!isI2cFsmBusy(&fsm));
+    CHECK(callbacks == 1);
+    CHECK(!s->busOwned);
+    return t->status;
+}
+
+static void testWrite(void)
+{
+    SIM s;
+    uint8_t data[] = { 0x01, 0x84, 0x83 };
+    I2C_TRANSACTION t = { SLAVE_ADD, data, 3, 0, 0, 0, 0, I2C_IDLE };
+
+    initSim(&s);
+    CHECK(runSim(&s, &t, 0) == I2C_DONE);
+    CHECK(s.mem[1] == 0x84 && s.mem[2] == 0x83);
+    CHECK(s.starts == 1 && s.stops == 1);
+}
+
+// Pointer write, repeated start, two byte read
+static void testWriteRead(void)
+{
+    SIM s;
+    uint8_t pointer = 0x10;
+    uint8_t data[2] = { 0, 0 };
+    I2C_TRANSACTION t = { SLAVE_ADD, &pointer, 1, data, 2, 0, 0, I2C_IDLE };
+
+    initSim(&s);
+    CHECK(runSim(&s, &t, 0) == I2C_DONE);
+    CHECK(data[0] == (0x10 ^ 0xA5) && data[1] == (0x11 ^ 0xA5));
+    CHECK(s.starts == 2 && s.stops == 1);
+}
+
+static void testRead(void)
+{
+    SIM s;
+    uint8_t data[3] = { 0, 0, 0 };
+    I2C_TRANSACTION t1 = { SLAVE_ADD, 0, 0, data, 1, 0, 0, I2C_IDLE };
+    I2C_TRANSACTION t3 = { SLAVE_ADD, 0, 0, data, 3, 0, 0, I2C_IDLE };
+
+    initSim(&s);
+    CHECK(runSim(&s, &t1, 0) == I2C_DONE);
+    CHECK(data[0] == 0xA5);
+    CHECK(runSim(&s, &t3, 0) == I2C_DONE);
+    CHECK(data[0] == (1 ^ 0xA5) && data[2] == (3 ^ 0xA5));
+    CHECK(s.stops == 2);
+}
+
+static void testPoll(void)
+{
+    SIM s;
+    I2C_TRANSACTION present = { SLAVE_ADD, 0, 0, 0, 0, 0, 0, I2C_IDLE };
+    I2C_TRANSACTION absent = { SLAVE_ADD + 1, 0, 0, 0, 0, 0, 0, I2C_IDLE };
+
+    initSim(&s);
+    CHECK(runSim(&s, &present, 0) == I2C_DONE);
+    CHECK(runSim(&s, &absent, 0) == I2C_ADDR_NACK);
+}
+
+// Every failure still leaves the bus released, with exactly one STOP
+static void testErrors(void)
+{
+    SIM s;
+    uint8_t data[] = { 0x01, 0x84, 0x83 };
+    uint8_t read[2];
+    I2C_TRANSACTION write = { SLAVE_ADD, data, 3, 0, 0, 0, 0, I2C_IDLE };
+    I2C_TRANSACTION wrongAdd = { SLAVE_ADD + 2, data, 3, 0, 0, 0, 0, I2C_IDLE };
+    I2C_TRANSACTION writeRead = { SLAVE_ADD, data, 1, read, 2, 0, 0, I2C_IDLE };
+    uint8_t at;
+
+    initSim(&s);
+    CHECK(runSim(&s, &wrongAdd, 0) == I2C_ADDR_NACK);
+    CHECK(s.stops == 1);
+
+    // nack on each byte, the last one is sent together with STOP
+    for (at = 0; at < 3; at++)
+    {
+        initSim(&s);
+        s.nackAt = at;
+        CHECK(runSim(&s, &write, 0) == I2C_DATA_NACK);
+        CHECK(s.stops == 1);
+    }
+
+    // nack on the pointer byte of a write-read, no read phase follows
+    initSim(&s);
+    s.nackAt = 0;
+    CHECK(runSim(&s, &writeRead, 0) == I2C_DATA_NACK);
+    CHECK(s.starts == 1 && s.stops == 1);
+
+    initSim(&s);
+    s.loseArbitration = true;
+    CHECK(runSim(&s, &write, 0) == I2C_ARB_LOST);
+    CHECK(s.stops == 0);
+}
+
+// High-speed mode adds the HS bit to every START, repeated ones included
+static void testHighSpeed(void)
+{
+    SIM s;
+    uint8_t pointer = 0;
+    uint8_t data[2];
+    I2C_TRANSACTION t = { SLAVE_ADD, &pointer, 1, data, 2, 0, 0, I2C_IDLE };
+
+    initSim(&s);
+    CHECK(runSim(&s, &t, I2C_FSM_HS) == I2C_DONE);
+    CHECK(s.starts == 2 && s.hsStarts == 2);
+}
+
+// A clock timeout ends the transaction without another access
+static void testAbort(void)
+{
+    I2C_FSM fsm = { 0 };
+    I2C_FSM_CMD cmd;
+    uint8_t data[] = { 0x01 };
+    I2C_TRANSACTION t = { SLAVE_ADD, data, 1, 0, 0, countCallback, 0, I2C_IDLE };
+
+    callbacks = 0;
+    i2cFsmStart(&fsm, &t, &cmd);
+    i2cFsmAbort(&fsm, I2C_TIMEOUT);
+    i2cFsmComplete(&fsm);
+    CHECK(t.status == I2C_TIMEOUT);
+    CHECK(callbacks == 1);
+    CHECK(!isI2cFsmBusy(&fsm));
+}
+
+//-----------------------------------------------------------------------------
+// Main
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    (void)argc;
+    testWrite();
+    testWriteRead();
+    testRead();
+    testPoll();
+    testErrors();
+    testHighSpeed();
+    testAbort();
+    return checkResult(argv[0]);
+}
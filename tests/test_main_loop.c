@@ -0,0 +1,167 @@
+// Main Loop Register Traffic Tests
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, built and run by tests/Makefile against the
+// peripheral simulator (stub/sim.h)
+// Counts the register writes per sample of the original main loop, which
+// re-initialized the clock, UART0 and I2C0 on every pass, against the
+// steady-state acquisition loop that initializes once
+// The GPIO library is a stub here, so the pin setup of the re-init is not
+// counted and the original loop is if anything under-counted
+
+//-----------------------------------------------------------------------------
+// Device includes, defines, and assembler directives
+//-----------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "check.h"
+#include "sim.h"
+#include "tm4c123gh6pm.h"
+#include "clock.h"
+#include "UART0.h"
+#include "i2c0.h"
+#include "ads1115.h"
+#include "tc_channels.h"
+#include "thermocouple.h"
+#include "wait.h"
+
+#define PASSES 20
+
+// What the original loop sampled: TMP36 on AIN0 and a thermocouple on
+// AIN2-AIN3 of the ADS1115 at 0x48
+static const TC_CHANNEL channelMap[] =
+{
+    { I2C0_BUS, 0x48, ADS1115_MUX_AIN0_GND,  ADS1115_PGA_2048, TC_CJC },
+    { I2C0_BUS, 0x48, ADS1115_MUX_AIN2_AIN3, ADS1115_PGA_256,  TC_TYPE_K },
+};
+
+#define CHANNEL_COUNT (sizeof(channelMap) / sizeof(channelMap[0]))
+
+// Registers only the init functions write
+static volatile uint32_t *const initRegisters[] =
+{
+    &SYSCTL_RCC_R, &UART0_IBRD_R, &I2C0_MTPR_R
+};
+
+#define INIT_REGISTER_COUNT (sizeof(initRegisters) / sizeof(initRegisters[0]))
+#define POISON 0xDEADBEEF
+
+//-----------------------------------------------------------------------------
+// Subroutines
+//-----------------------------------------------------------------------------
+
+static uint32_t getWrites(void)
+{
+    SIM_COUNTS counts;
+    getSimCounts(&counts);
+    return counts.writes;
+}
+
+// Mark the init registers so a later write shows
+static void poisonInitRegisters(void)
+{
+    uint8_t i;
+    for (i = 0; i < INIT_REGISTER_COUNT; i++)
+        *simCell((uint32_t)(uintptr_t)initRegisters[i]) = POISON;
+}
+
+static bool isInitRewritten(void)
+{
+    bool rewritten = false;
+    uint8_t i;
+    for (i = 0; i < INIT_REGISTER_COUNT; i++)
+        rewritten |= *simCell((uint32_t)(uintptr_t)initRegisters[i]) != POISON;
+    return rewritten;
+}
+
+// Polled sample of the original loop: read the config, set the mux and PGA
+// bits of its MSB, write it back, wait 10 ms and read the conversion
+static void sampleOld(uint8_t muxPga)
+{
+    uint8_t config[2];
+    uint8_t data[2];
+
+    readI2c0Registers(0x48, ADS1115_CONFIG, config, 2);
+    config[0] = (config[0] & ~0x7E) | muxPga;
+    writeI2c0Registers(0x48, ADS1115_CONFIG, config, 2);
+    waitMicrosecond(10000);
+    readI2c0Registers(0x48, ADS1115_CONVERSION, data, 2);
+}
+
+// One pass of the original main loop
+static void runOldPass(void)
+{
+    initSystemClockTo40Mhz();
+    initUart0();
+    initI2c0(40000000, I2C_FAST_HZ);
+    setUart0BaudRate(115200, 40000000, 0);
+    putsUart0("\n\nThermocouple Serial Start\n");
+    sampleOld(0x44);                                    // AIN0-GND, +/-2.048 V
+    sampleOld(0x3E);                                    // AIN2-AIN3, +/-0.256 V
+}
+
+static void testMainLoop(void)
+{
+    SIM_ADS1115 *adc = simAddAds1115(0, 0x48);
+    int32_t centiC[CHANNEL_COUNT];
+    int16_t raw[CHANNEL_COUNT];
+    uint32_t oldWrites, newWrites, writes;
+    uint8_t pass;
+    bool ok = true;
+
+    adc->ainUv[0] = 750000;                             // TMP36 at 25 C
+    adc->ainUv[2] = 1000;                               // type K, about 25 C above the cold junction
+    adc->ainUv[3] = 0;
+
+    // original: everything re-initialized on every pass
+    runOldPass();
+    poisonInitRegisters();
+    writes = getWrites();
+    for (pass = 0; pass < PASSES; pass++)
+        runOldPass();
+    oldWrites = getWrites() - writes;
+    CHECK(isInitRewritten());
+
+    // now: initialize once, then only acquisition in the loop
+    initSystemClockTo40Mhz();
+    initUart0();
+    initI2c0(40000000, I2C_FAST_HZ);
+    CHECK(initTcChannels(channelMap, CHANNEL_COUNT, ADS1115_DR_128));
+    poisonInitRegisters();
+    writes = getWrites();
+    for (pass = 0; pass < PASSES; pass++)
+        ok &= scanTcChannels(centiC, raw, (1 << CHANNEL_COUNT) - 1);
+    newWrites = getWrites() - writes;
+    CHECK(ok);
+    CHECK(!isInitRewritten());
+    CHECK_NEAR(centiC[0], 2500, 1);
+    CHECK_NEAR(centiC[1], tc_convert_uv(TC_TYPE_K, 1000, 2500), 1);
+
+    printf("register writes per sample: re-init loop %.1f, steady state %.1f\n",
+           (double)oldWrites / (PASSES * CHANNEL_COUNT), (double)newWrites / (PASSES * CHANNEL_COUNT));
+    CHECK(newWrites < oldWrites);
+}
+
+//-----------------------------------------------------------------------------
+// Main
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    (void)argc;
+    simInit();
+    simInitI2c();
+    simInitTimers();
+    simVector(INT_I2C0, i2c0Isr);
+    simVector(INT_GPIOB, ads1115AlertIsr);
+    simVector(INT_TIMER2A, ads1115TimerIsr);
+    simVector(INT_UART0, uart0Isr);
+    *simCell((uint32_t)(uintptr_t)&UART0_FR_R) = UART_FR_RXFE | UART_FR_TXFE;
+
+    testMainLoop();
+    return checkResult(argv[0]);
+}
@@ -0,0 +1,83 @@
+// Batch Conversion Tests
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, built and run by tests/Makefile
+
+//-----------------------------------------------------------------------------
+// Device includes, defines, and assembler directives
+//-----------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <stddef.h>
+#include "check.h"
+#include "tc_batch.h"
+#include "typek.h"
+
+#define BATCH 4096
+
+//-----------------------------------------------------------------------------
+// Subroutines
+//-----------------------------------------------------------------------------
+
+// One sample through the scalar table engine, as the firmware converts it
+static float convertOne(int16_t rawTc, int16_t rawCjc)
+{
+    float cjcC = (rawCjc * 62.5f - 750000.0f) * 0.0001f + 25.0f;
+    return typek_table_mv_to_temp(rawTc * 0.0078125f + typek_table_temp_to_mv(cjcC));
+}
+
+// Every thermocouple count at a few cold junction temperatures, in batches
+// that do not divide the count so the vector tail is covered too
+static void testMatchesScalar(void)
+{
+    static const int16_t cjc[] = { 8000, 12000, 15200, 20000 };  // -50, 0, 20, 50 C
+    int16_t rawTc[BATCH], rawCjc[BATCH];
+    float out[BATCH];
+    int32_t raw = INT16_MIN;
+    size_t n, k;
+    uint8_t c;
+
+    for (c = 0; c < sizeof(cjc) / sizeof(cjc[0]); c++)
+    {
+        raw = INT16_MIN;
+        while (raw <= INT16_MAX)
+        {
+            for (n = 0; n < BATCH - 3 && raw <= INT16_MAX; n++, raw++)
+            {
+                rawTc[n] = raw;
+                rawCjc[n] = cjc[c];
+            }
+            convert_batch(rawTc, rawCjc, out, n);
+            for (k = 0; k < n; k++)
+                CHECK_NEAR(out[k], convertOne(rawTc[k], rawCjc[k]), 0.01);
+        }
+    }
+}
+
+// A sum outside of the type K range converts to 0, the thermocouple input
+// reaches 256 mV at full scale
+static void testRange(void)
+{
+    int16_t rawTc[2] = { INT16_MAX, 100 };
+    int16_t rawCjc[2] = { 12000, 12000 };
+    float out[2];
+
+    convert_batch(rawTc, rawCjc, out, 2);
+    CHECK(out[0] == 0);
+    CHECK(out[1] != 0);
+}
+
+//-----------------------------------------------------------------------------
+// Main
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    (void)argc;
+    testMatchesScalar();
+    testRange();
+    return checkResult(argv[0]);
+}
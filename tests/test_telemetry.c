@@ -0,0 +1,306 @@
+// Telemetry Frame Tests
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, built and run by tests/Makefile
+// telemetry.c is included so the static COBS coder can be tested on blocks
+// longer than a frame and the header read back
+
+//-----------------------------------------------------------------------------
+// Device includes, defines, and assembler directives
+//-----------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "check.h"
+#include "../telemetry.c"
+
+#define BLOCK_MAX 1000
+
+//-----------------------------------------------------------------------------
+// Subroutines
+//-----------------------------------------------------------------------------
+
+// CRC-16/CCITT-FALSE check value
+static void testCrc(void)
+{
+    CHECK(crc16((const uint8_t *)"123456789", 9) == 0x29B1);
+    CHECK(crc16(0, 0) == 0xFFFF);
+}
+
+// Round trip blocks with no zeros, all zeros, and zeros around the 254 byte
+// run limit
+static void testCobs(void)
+{
+    static const uint16_t sizes[] = { 1, 2, 253, 254, 255, 256, 508, 509, BLOCK_MAX };
+    uint8_t in[BLOCK_MAX], out[BLOCK_MAX + BLOCK_MAX / 254 + 2], back[BLOCK_MAX];
+    uint16_t size, encoded, i;
+    uint8_t s, pattern;
+
+    for (pattern = 0; pattern < 4; pattern++)
+    {
+        for (s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+        {
+            size = sizes[s];
+            for (i = 0; i < size; i++)
+            {
+                switch (pattern)
+                {
+                case 0: in[i] = i % 255 + 1; break;             // no zeros
+                case 1: in[i] = 0; break;
+                case 2: in[i] = (i % 254 == 253) ? 0 : 0x55; break;
+                default: in[i] = rand() % 4 ? rand() : 0; break;
+                }
+            }
+            encoded = cobsEncode(in, size, out);
+            CHECK(encoded <= size + size / 254 + 1);
+            CHECK(memchr(out, 0, encoded) == 0);
+            CHECK(cobsDecode(out, encoded, back, sizeof(back)) == size);
+            CHECK(memcmp(in, back, size) == 0);
+        }
+    }
+}
+
+// Random walk of the channels in mask, with a full scale step now and then
+static void randomScan(TELEMETRY_SCAN *scan, const TELEMETRY_SCAN *last, uint16_t mask)
+{
+    uint8_t i;
+
+    scan->timestampMs = last->timestampMs + rand() % 50;
+    scan->fault = rand() % 8 == 0;
+    for (i = 0; i < TELEMETRY_CHANNEL_MAX; i++)
+    {
+        scan->raw[i] = 0;
+        scan->centiC[i] = 0;
+        if (!(mask & (1 << i)))
+            continue;
+        if (rand() % 16 == 0)
+        {
+            scan->raw[i] = rand() & 1 ? INT16_MAX : INT16_MIN;
+            scan->centiC[i] = rand() % 0x1000000 - 0x800000;
+        }
+        else
+        {
+            scan->raw[i] = last->raw[i] + rand() % 64 - 32;
+            scan->centiC[i] = last->centiC[i] + rand() % 2000 - 1000;
+        }
+    }
+}
+
+// Fill a frame with random scans until it is full or has count of them
+static uint8_t fillFrame(TELEMETRY_ENCODER *e, TELEMETRY_SCAN scan[], uint16_t mask, uint8_t count)
+{
+    TELEMETRY_SCAN start;
+    uint8_t n;
+
+    memset(&start, 0, sizeof(start));
+    start.timestampMs = (uint32_t)rand() << 8;
+    startTelemetry(e, rand(), mask, rand());
+    for (n = 0; n < count; n++)
+    {
+        randomScan(&scan[n], n ? &scan[n - 1] : &start, mask);
+        if (!addTelemetryScan(e, scan[n].timestampMs, scan[n].fault, scan[n].raw, scan[n].centiC))
+            break;
+    }
+    return n;
+}
+
+// Random masks and scan counts, with zero bytes in the payload
+static void testFrames(void)
+{
+    static TELEMETRY_SCAN scan[TELEMETRY_SCAN_MAX];
+    static TELEMETRY_FRAME back;
+    TELEMETRY_ENCODER e;
+    uint8_t out[TELEMETRY_ENCODED_MAX];
+    uint16_t size, mask, sequence, cjcMask;
+    uint8_t count, pass, i;
+    bool ok = true;
+
+    for (pass = 0; pass < 200; pass++)
+    {
+        mask = pass == 0 ? 0 : pass == 1 ? 0xFFFF : rand();
+        count = fillFrame(&e, scan, mask, rand() % TELEMETRY_SCAN_MAX + 1);
+        CHECK(count > 0);
+        CHECK(getTelemetryScanCount(&e) == count);
+        CHECK(getTelemetryStartMs(&e) == scan[0].timestampMs);
+        sequence = getLe(e.raw + 1, 2);
+        cjcMask = getLe(e.raw + 5, 2);
+        size = finishTelemetry(&e, out);
+        CHECK(e.size == 0 && getTelemetryScanCount(&e) == 0);
+        CHECK(size <= TELEMETRY_ENCODED_MAX);
+        CHECK(out[size - 1] == 0);
+        CHECK(memchr(out, 0, size - 1) == 0);
+        CHECK(decodeTelemetry(out, size - 1, &back));
+        CHECK(back.version == TELEMETRY_VERSION);
+        CHECK(back.sequence == sequence);
+        CHECK(back.channelMask == mask);
+        CHECK(back.cjcMask == cjcMask && (cjcMask & ~mask) == 0);
+        CHECK(back.count == count);
+        for (i = 0; i < count; i++)
+        {
+            ok &= back.scan[i].timestampMs == scan[i].timestampMs;
+            ok &= back.scan[i].fault == scan[i].fault;
+            ok &= memcmp(back.scan[i].raw, scan[i].raw, sizeof(scan[i].raw)) == 0;
+            ok &= memcmp(back.scan[i].centiC, scan[i].centiC, sizeof(scan[i].centiC)) == 0;
+        }
+    }
+    CHECK(ok);
+}
+
+// Temperatures beyond 24 bits are clamped; a scan that does not fit, past
+// TELEMETRY_SCAN_MAX or 2^31 ms after the last is refused and leaves the
+// frame as it was; the millisecond tick may wrap inside a frame
+static void testLimits(void)
+{
+    static TELEMETRY_FRAME back;
+    TELEMETRY_ENCODER e;
+    uint8_t out[TELEMETRY_ENCODED_MAX];
+    int16_t raw[TELEMETRY_CHANNEL_MAX] = { 0 };
+    int32_t centiC[TELEMETRY_CHANNEL_MAX] = { 0 };
+    uint16_t size;
+    uint8_t count, i;
+
+    startTelemetry(&e, 1, 3, 0);
+    centiC[0] = 0x1000000;
+    centiC[1] = -0x1000000;
+    CHECK(addTelemetryScan(&e, 0, false, raw, centiC));
+    size = finishTelemetry(&e, out);
+    CHECK(decodeTelemetry(out, size - 1, &back));
+    CHECK(back.scan[0].centiC[0] == 0x7FFFFF);
+    CHECK(back.scan[0].centiC[1] == -0x800000);
+
+    // alternating full scale values take the most bytes per scan
+    startTelemetry(&e, 1, 0xFFFF, 0);
+    for (count = 0; ; count++)
+    {
+        for (i = 0; i < TELEMETRY_CHANNEL_MAX; i++)
+        {
+            raw[i] = count & 1 ? INT16_MAX : INT16_MIN;
+            centiC[i] = count & 1 ? 0x7FFFFF : -0x800000;
+        }
+        size = e.size;
+        if (!addTelemetryScan(&e, count, false, raw, centiC))
+            break;
+    }
+    CHECK(count >= 1);
+    CHECK(e.size == size && getTelemetryScanCount(&e) == count);
+    size = finishTelemetry(&e, out);
+    CHECK(decodeTelemetry(out, size - 1, &back));
+    CHECK(back.count == count);
+    CHECK(back.scan[count - 1].raw[15] == (count & 1 ? INT16_MIN : INT16_MAX));
+
+    startTelemetry(&e, 1, 0, 0);
+    for (count = 0; count < TELEMETRY_SCAN_MAX; count++)
+        CHECK(addTelemetryScan(&e, count, false, raw, centiC));
+    CHECK(!addTelemetryScan(&e, count, false, raw, centiC));
+    CHECK(getTelemetryScanCount(&e) == TELEMETRY_SCAN_MAX);
+
+    startTelemetry(&e, 1, 1, 0);
+    CHECK(addTelemetryScan(&e, 0xFFFFFFF0, false, raw, centiC));
+    CHECK(addTelemetryScan(&e, 0x10, true, raw, centiC));
+    CHECK(!addTelemetryScan(&e, 0x80000010, false, raw, centiC));
+    size = finishTelemetry(&e, out);
+    CHECK(decodeTelemetry(out, size - 1, &back));
+    CHECK(back.count == 2);
+    CHECK(back.scan[0].timestampMs == 0xFFFFFFF0 && !back.scan[0].fault);
+    CHECK(back.scan[1].timestampMs == 0x10 && back.scan[1].fault);
+}
+
+// Any changed or missing byte is rejected
+static void testCorruption(void)
+{
+    static TELEMETRY_SCAN scan[TELEMETRY_SCAN_MAX];
+    static TELEMETRY_FRAME back;
+    TELEMETRY_ENCODER e;
+    uint8_t out[TELEMETRY_ENCODED_MAX];
+    uint8_t bad[TELEMETRY_ENCODED_MAX];
+    uint16_t size, i;
+
+    fillFrame(&e, scan, 0xFF, 8);
+    size = finishTelemetry(&e, out) - 1;
+    for (i = 0; i < size; i++)
+    {
+        memcpy(bad, out, size);
+        bad[i] ^= bad[i] == 1 ? 3 : 1;
+        CHECK(!decodeTelemetry(bad, size, &back));
+    }
+    for (i = 0; i < size; i++)
+        CHECK(!decodeTelemetry(out, i, &back));
+    CHECK(!decodeTelemetry(out, size + 1, &back));
+}
+
+// Bytes per value of the original text lines against frames of 100 ms of
+// 100 Hz scans
+// A TMP36 reads 160 counts/C at +/-2.048 V and a type K about 5.2 counts/C
+// at +/-0.256 V; each drifts slowly with +/-2 counts of noise
+static double getTextRatio(uint16_t mask, uint16_t cjcMask)
+{
+    TELEMETRY_ENCODER e;
+    uint8_t out[TELEMETRY_ENCODED_MAX];
+    char text[64];
+    int16_t raw[TELEMETRY_CHANNEL_MAX] = { 0 };
+    int32_t centiC[TELEMETRY_CHANNEL_MAX] = { 0 };
+    double tempC[TELEMETRY_CHANNEL_MAX];
+    double countsPerC;
+    uint32_t binaryBytes = 0, textBytes = 0, values = 0;
+    uint32_t ms;
+    uint8_t i;
+
+    for (i = 0; i < TELEMETRY_CHANNEL_MAX; i++)
+        tempC[i] = cjcMask & (1 << i) ? 25 : 20 + 30 * i;
+    e.size = 0;
+    for (ms = 0; ms < 60000; ms += 10)
+    {
+        if (e.size == 0)
+            startTelemetry(&e, ms, mask, cjcMask);
+        for (i = 0; i < TELEMETRY_CHANNEL_MAX; i++)
+        {
+            if (!(mask & (1 << i)))
+                continue;
+            countsPerC = cjcMask & (1 << i) ? 160 : 5.2;
+            tempC[i] += (rand() % 101 - 50) / 10000.0;
+            raw[i] = (int16_t)(tempC[i] * countsPerC + 0.5) + rand() % 5 - 2;
+            centiC[i] = raw[i] * 100 / countsPerC;
+            if (cjcMask & (1 << i))
+                textBytes += snprintf(text, sizeof(text), "\nTMP Temp: %0.1f C\n", centiC[i] / 100.0);
+            else
+                textBytes += snprintf(text, sizeof(text), "Thermocouple Temp: %0.1f\n", centiC[i] / 100.0);
+            values++;
+        }
+        CHECK(addTelemetryScan(&e, ms, false, raw, centiC));
+        if (ms + 10 - getTelemetryStartMs(&e) >= 100)
+            binaryBytes += finishTelemetry(&e, out);
+    }
+    printf("mask 0x%04X: text %.1f, binary %.2f bytes per value, %.1fx\n", mask,
+           (double)textBytes / values, (double)binaryBytes / values, (double)textBytes / binaryBytes);
+    return (double)textBytes / binaryBytes;
+}
+
+// At least 5 times smaller than the text it replaced, per value
+static void testCompression(void)
+{
+    CHECK(getTextRatio(0x0003, 0x0001) >= 5);           // the original TMP36 and thermocouple
+    CHECK(getTextRatio(0x00FF, 0x0001) >= 5);
+}
+
+//-----------------------------------------------------------------------------
+// Main
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    (void)argc;
+    srand(1);
+    testCrc();
+    testCobs();
+    testFrames();
+    testLimits();
+    testCorruption();
+    testCompression();
+    return checkResult(argv[0]);
+}
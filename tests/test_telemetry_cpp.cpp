@@ -0,0 +1,39 @@
+// Telemetry C++ Linkage Test
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, built and run by tests/Makefile
+// A C++ host tool includes telemetry.h and links telemetry.c built as C
+
+//-----------------------------------------------------------------------------
+// Device includes, defines, and assembler directives
+//-----------------------------------------------------------------------------
+
+#include <stdint.h>
+#include "check.h"
+#include "telemetry.h"
+
+//-----------------------------------------------------------------------------
+// Main
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    static TELEMETRY_FRAME back = {};
+    TELEMETRY_ENCODER e;
+    int16_t raw[TELEMETRY_CHANNEL_MAX] = {};
+    int32_t centiC[TELEMETRY_CHANNEL_MAX] = {};
+    uint8_t out[TELEMETRY_ENCODED_MAX];
+    uint16_t size;
+
+    (void)argc;
+    startTelemetry(&e, 0, 1, 0);
+    centiC[0] = -1234;
+    CHECK(addTelemetryScan(&e, 0, false, raw, centiC));
+    size = finishTelemetry(&e, out);
+    CHECK(decodeTelemetry(out, size - 1, &back));
+    CHECK(back.scan[0].centiC[0] == -1234);
+    return checkResult(argv[0]);
+}
@@ -0,0 +1,158 @@
+// Thermocouple Library Tests
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, built and run by tests/Makefile
+
+//-----------------------------------------------------------------------------
+// Device includes, defines, and assembler directives
+//-----------------------------------------------------------------------------
+
+#include <stdint.h>
+#include "check.h"
+#include "thermocouple.h"
+#include "typek.h"
+#include "tc_nist.h"
+
+// Reference breakpoints of every table type
+typedef struct _NIST_POINT
+{
+    int16_t t;
+    int32_t uv;
+} NIST_POINT;
+
+#define TC_POINT(t, uv) { t, uv },
+
+static const NIST_POINT nistB[] = { TC_NIST_B(TC_POINT) };
+static const NIST_POINT nistE[] = { TC_NIST_E(TC_POINT) };
+static const NIST_POINT nistJ[] = { TC_NIST_J(TC_POINT) };
+static const NIST_POINT nistN[] = { TC_NIST_N(TC_POINT) };
+static const NIST_POINT nistR[] = { TC_NIST_R(TC_POINT) };
+static const NIST_POINT nistS[] = { TC_NIST_S(TC_POINT) };
+static const NIST_POINT nistT[] = { TC_NIST_T(TC_POINT) };
+
+typedef struct _NIST_TABLE
+{
+    TC_TYPE type;
+    const NIST_POINT *point;
+    uint16_t count;
+    int16_t reverseFrom;                                // curve is monotonic from here
+} NIST_TABLE;
+
+#define NIST_COUNT(a) (sizeof(a) / sizeof(a[0]))
+
+// Type B has a minimum near 20 C and is only inverted from 250 C
+static const NIST_TABLE tables[] =
+{
+    { TC_TYPE_B, nistB, NIST_COUNT(nistB), 250 },
+    { TC_TYPE_E, nistE, NIST_COUNT(nistE), -270 },
+    { TC_TYPE_J, nistJ, NIST_COUNT(nistJ), -210 },
+    { TC_TYPE_N, nistN, NIST_COUNT(nistN), -270 },
+    { TC_TYPE_R, nistR, NIST_COUNT(nistR), -50 },
+    { TC_TYPE_S, nistS, NIST_COUNT(nistS), -50 },
+    { TC_TYPE_T, nistT, NIST_COUNT(nistT), -270 },
+};
+
+//-----------------------------------------------------------------------------
+// Subroutines
+//-----------------------------------------------------------------------------
+
+// Breakpoints convert exactly both ways with the float and integer engines
+static void testBreakpoints(void)
+{
+    const NIST_TABLE *table;
+    uint8_t i;
+    uint16_t j;
+
+    for (i = 0; i < NIST_COUNT(tables); i++)
+    {
+        table = &tables[i];
+        for (j = 0; j < table->count; j++)
+        {
+            CHECK_NEAR(tc_temp_to_mv(table->type, table->point[j].t), table->point[j].uv / 1000.0, 0.0005);
+            CHECK(tc_temp_to_uv(table->type, table->point[j].t * 100) == table->point[j].uv);
+            if (table->point[j].t < table->reverseFrom)
+                continue;
+            CHECK_NEAR(tc_mv_to_temp(table->type, table->point[j].uv / 1000.0f), table->point[j].t, 0.01);
+            CHECK(tc_uv_to_temp(table->type, table->point[j].uv) == table->point[j].t * 100);
+        }
+    }
+}
+
+// Between breakpoints the integer engine is the float one rounded
+static void testIntegerMatchesFloat(void)
+{
+    const NIST_TABLE *table;
+    int32_t centiC, uv;
+    uint8_t i;
+
+    for (i = 0; i < NIST_COUNT(tables); i++)
+    {
+        table = &tables[i];
+        for (centiC = table->point[0].t * 100; centiC <= table->point[table->count - 1].t * 100; centiC += 37)
+        {
+            uv = tc_temp_to_uv(table->type, centiC);
+            CHECK_NEAR(uv, tc_temp_to_mv(table->type, centiC / 100.0f) * 1000, 0.51);
+            if (centiC >= table->reverseFrom * 100)
+                CHECK_NEAR(tc_uv_to_temp(table->type, uv), tc_mv_to_temp(table->type, uv / 1000.0f) * 100, 0.51);
+        }
+    }
+}
+
+// Type K goes to the engine selected in typek.h
+static void testTypeK(void)
+{
+    CHECK(tc_temp_to_uv(TC_TYPE_K, 10000) == typek_temp_to_uv(10000));
+    CHECK(tc_uv_to_temp(TC_TYPE_K, 4096) == typek_uv_to_temp(4096));
+    CHECK_NEAR(tc_temp_to_mv(TC_TYPE_K, 100), typek_temp_to_mv(100), 0);
+    CHECK_NEAR(tc_mv_to_temp(TC_TYPE_K, 4.096f), typek_mv_to_temp(4.096f), 0);
+}
+
+// The cold junction voltage is added before the reverse conversion
+// The integer cold junction voltage is rounded to 1 uV, which is up to
+// 0.5 uV / slope of temperature, 0.08 C for types R and S near 25 C
+static void testColdJunction(void)
+{
+    TC_TYPE type;
+    int32_t cjcUv, slope;
+
+    for (type = TC_TYPE_E; type < TC_TYPE_COUNT; type++)
+    {
+        cjcUv = tc_temp_to_uv(type, 2500);
+        slope = tc_temp_to_uv(type, 2600) - cjcUv;
+        CHECK_NEAR(tc_convert(type, 1.0f, 25), tc_mv_to_temp(type, 1.0f + tc_temp_to_mv(type, 25)), 0);
+        CHECK(tc_convert_uv(type, 1000, 2500) == tc_uv_to_temp(type, 1000 + cjcUv));
+        CHECK_NEAR(tc_convert_uv(type, 1000, 2500), tc_mv_to_temp(type, (1000 + cjcUv) / 1000.0f) * 100, 0.51);
+        CHECK_NEAR(tc_convert_uv(type, 0, 2500), 2500, 50.0 / slope + 0.51);
+    }
+    CHECK(tc_convert_uv(TC_TYPE_K, 4096 - 1000, 2500) == typek_uv_to_temp(4096 - 1000 + typek_temp_to_uv(2500)));
+}
+
+// Out of range inputs and unknown types give 0
+static void testRange(void)
+{
+    CHECK(tc_temp_to_mv(TC_TYPE_T, 401) == 0);
+    CHECK(tc_temp_to_uv(TC_TYPE_T, 40001) == 0);
+    CHECK(tc_uv_to_temp(TC_TYPE_J, -8096) == 0);
+    CHECK(tc_uv_to_temp(TC_TYPE_B, 100) == 0);
+    CHECK(tc_convert_uv(TC_TYPE_B, 0, 2500) == 0);
+    CHECK(tc_convert(TC_TYPE_COUNT, 1.0f, 25) == 0);
+    CHECK(tc_convert_uv(TC_TYPE_COUNT, 1000, 2500) == 0);
+}
+
+//-----------------------------------------------------------------------------
+// Main
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    (void)argc;
+    testBreakpoints();
+    testIntegerMatchesFloat();
+    testTypeK();
+    testColdJunction();
+    testRange();
+    return checkResult(argv[0]);
+}
@@ -0,0 +1,210 @@
+// Type K Engine Tests
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, built and run by tests/Makefile
+// Built once per TYPEK_STEP and once with the polynomial engine selected,
+// the table tolerances below follow the step
+
+//-----------------------------------------------------------------------------
+// Device includes, defines, and assembler directives
+//-----------------------------------------------------------------------------
+
+#include <stdint.h>
+#include "check.h"
+#include "typek.h"
+#include "typek_chain.h"
+
+// Largest table error against the 1 C NIST points, forward in uV and
+// reverse in deg C, from the linear interpolation between breakpoints
+#if TYPEK_STEP == 10
+#define TABLE_UV 3.5
+#define TABLE_C  0.2
+#elif TYPEK_STEP == 5
+#define TABLE_UV 1.5
+#define TABLE_C  0.1
+#else
+#define TABLE_UV 0.5
+#define TABLE_C  0.02
+#endif
+
+// The original if-chain interpolated the same 10 C breakpoints, so the 10 C
+// table reproduces it to float rounding and finer tables to within the 10 C
+// interpolation error
+#if TYPEK_STEP == 10
+#define CHAIN_UV 0.5
+#define CHAIN_C  0.001
+#else
+#define CHAIN_UV (3.5 + TABLE_UV)
+#define CHAIN_C  (0.2 + TABLE_C)
+#endif
+
+// NIST inverse polynomials are specified to -0.05/+0.06 C, plus 1 uV of
+// table rounding
+#define POLY_UV 1.0
+#define POLY_C  0.07
+
+// Every NIST point, 1 C apart from -270 to 1372 C
+typedef struct _NIST_POINT
+{
+    int16_t t;
+    int32_t uv;
+} NIST_POINT;
+
+#define NIST_BEGIN(t, uv) { t, uv },
+#define NIST10(t, uv) { t, uv },
+#define NIST5(t, uv) { t, uv },
+#define NIST1(t, uv) { t, uv },
+#define NIST_END(t, uv) { t, uv }
+
+static const NIST_POINT nist[] =
+{
+#include "typek_nist.h"
+};
+
+#define NIST_COUNT (sizeof(nist) / sizeof(nist[0]))
+
+//-----------------------------------------------------------------------------
+// Subroutines
+//-----------------------------------------------------------------------------
+
+// Table and fixed-point engines against the reference
+// Reverse conversion is checked from -200 C, below that the curve is too flat
+// for a temperature tolerance to mean much and the round trip is checked
+static void testTable(void)
+{
+    uint16_t i;
+    float t, mv;
+
+    CHECK(NIST_COUNT == TYPEK_T_MAX - TYPEK_T_MIN + 1);
+    for (i = 0; i < NIST_COUNT; i++)
+    {
+        t = nist[i].t;
+        mv = nist[i].uv / 1000.0f;
+        CHECK_NEAR(typek_table_temp_to_mv(t) * 1000, nist[i].uv, TABLE_UV);
+        CHECK_NEAR(typek_fixed_temp_to_uv(nist[i].t * 100), nist[i].uv, TABLE_UV);
+        if (t >= -200)
+        {
+            CHECK_NEAR(typek_table_mv_to_temp(mv), t, TABLE_C);
+            CHECK_NEAR(typek_fixed_uv_to_temp(nist[i].uv) / 100.0, t, TABLE_C);
+        }
+        else
+            CHECK_NEAR(typek_table_mv_to_temp(typek_table_temp_to_mv(t)), t, 0.01);
+    }
+}
+
+// The generated slopes are the breakpoint differences, rounded once
+static void testGeneratedTables(void)
+{
+    uint16_t i;
+    double width, delta;
+
+    for (i = 0; i < TYPEK_SEGMENT_COUNT; i++)
+    {
+        width = (i == TYPEK_SEGMENT_COUNT - 1 ? TYPEK_LAST_WIDTH : TYPEK_STEP) * 100.0;
+        delta = typekUv[i + 1] - typekUv[i];
+        CHECK(delta > 0);
+        CHECK_NEAR(typekSlope[i], delta * 65536 / width, 0.5);
+        CHECK_NEAR(typekInverseSlope[i], width * 65536 / delta, 0.5);
+    }
+}
+
+// Table engine against the original if-chain every 0.25 C and 1 uV, and at
+// every breakpoint of the chain
+// The chain's last rung runs from 1370 to 1382 C with a slope fitted to 1382,
+// so its last 2 C are not type K and are left out. -6.458f rounds below the
+// double -6.458 of the first reverse rung, so the ladder returns 0 there. Finer
+// tables are compared in reverse from -200 C like the NIST check above
+static void testChain(void)
+{
+    int32_t quarterC, uv;
+    uint16_t i;
+    float t, mv;
+
+    for (quarterC = TYPEK_T_MIN * 4; quarterC <= 1370 * 4; quarterC++)
+    {
+        t = quarterC / 4.0f;
+        CHECK_NEAR(typek_table_temp_to_mv(t) * 1000, chainTempToMv(t) * 1000, CHAIN_UV);
+    }
+    for (uv = (TYPEK_STEP == 10 ? TYPEK_UV_MIN + 1 : -5891); uv <= 54819; uv++)
+    {
+        mv = uv / 1000.0f;
+        CHECK_NEAR(typek_table_mv_to_temp(mv), chainMvToTemp(mv), CHAIN_C);
+    }
+    for (i = 10; i < NIST_COUNT; i += 10)
+    {
+        mv = nist[i].uv / 1000.0f;
+        CHECK_NEAR(typek_table_mv_to_temp(mv), chainMvToTemp(mv), 0.001);
+        CHECK_NEAR(typek_table_mv_to_temp(mv), nist[i].t, 0.001);
+    }
+}
+
+// The integer engine is the float table engine rounded to the nearest unit
+static void testFixedMatchesTable(void)
+{
+    int32_t centiC, uv;
+
+    for (centiC = TYPEK_T_MIN * 100; centiC <= TYPEK_T_MAX * 100; centiC += 7)
+        CHECK_NEAR(typek_fixed_temp_to_uv(centiC), typek_table_temp_to_mv(centiC / 100.0f) * 1000, 0.51);
+    for (uv = TYPEK_UV_MIN; uv <= TYPEK_UV_MAX; uv += 3)
+        CHECK_NEAR(typek_fixed_uv_to_temp(uv), typek_table_mv_to_temp(uv / 1000.0f) * 100, 0.51);
+}
+
+// The default entry points agree with each other for the selected engine,
+// the round trip is within the inverse polynomial error
+static void testSelected(void)
+{
+    int32_t centiC;
+
+    for (centiC = -20000; centiC <= 130000; centiC += 1111)
+    {
+        CHECK_NEAR(typek_temp_to_uv(centiC), typek_temp_to_mv(centiC / 100.0f) * 1000, 0.51);
+        CHECK_NEAR(typek_uv_to_temp(typek_temp_to_uv(centiC)), centiC, POLY_C * 100);
+    }
+}
+
+static void testPolynomial(void)
+{
+    uint16_t i;
+
+    for (i = 0; i < NIST_COUNT; i++)
+    {
+        CHECK_NEAR(typek_poly_temp_to_mv(nist[i].t) * 1000, nist[i].uv, POLY_UV);
+        if (nist[i].t >= -200)
+            CHECK_NEAR(typek_poly_mv_to_temp(nist[i].uv / 1000.0f), nist[i].t, POLY_C);
+    }
+}
+
+// Every engine returns 0 outside of the range of the type
+static void testRange(void)
+{
+    CHECK(typek_table_temp_to_mv(TYPEK_T_MIN - 1) == 0);
+    CHECK(typek_table_temp_to_mv(TYPEK_T_MAX + 1) == 0);
+    CHECK(typek_table_mv_to_temp(TYPEK_MV_MAX + 0.01f) == 0);
+    CHECK(typek_fixed_temp_to_uv(TYPEK_T_MIN * 100 - 1) == 0);
+    CHECK(typek_fixed_temp_to_uv(TYPEK_T_MAX * 100 + 1) == 0);
+    CHECK(typek_fixed_uv_to_temp(TYPEK_UV_MIN - 1) == 0);
+    CHECK(typek_fixed_uv_to_temp(TYPEK_UV_MAX + 1) == 0);
+    CHECK(typek_poly_temp_to_mv(TYPEK_T_MAX + 1) == 0);
+    CHECK_NEAR(typek_fixed_temp_to_uv(TYPEK_T_MAX * 100), TYPEK_UV_MAX, 0);
+    CHECK_NEAR(typek_fixed_uv_to_temp(TYPEK_UV_MIN), TYPEK_T_MIN * 100, 0);
+}
+
+//-----------------------------------------------------------------------------
+// Main
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    (void)argc;
+    testTable();
+    testGeneratedTables();
+    testChain();
+    testFixedMatchesTable();
+    testPolynomial();
+    testSelected();
+    testRange();
+    return checkResult(argv[0]);
+}
@@ -0,0 +1,500 @@
+// UART0 Tests
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, built and run by tests/Makefile against the
+// peripheral simulator (stub/sim.h)
+// The baud divisors, the field parser and the command table, then the TX
+// ring, the uDMA frames and telemetry frames through uart0Isr
+// Nothing here may wait on memory alone, the simulated time only moves on a
+// register access: no blocking write to a full ring, no getcUart0 with the
+// ring empty and no baud change with data queued
+
+//-----------------------------------------------------------------------------
+// Device includes, defines, and assembler directives
+//-----------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+#include <string.h>
+#include "check.h"
+#include "sim.h"
+#include "tm4c123gh6pm.h"
+#include "wait.h"
+#include "UART0.h"
+
+static const uint32_t rates[] =
+{
+    300, 1200, 9600, 19200, 38400, 57600, 115200, 230400, 460800, 921600,
+    1000000, 1500000, 2000000, 2500000, 5000000, 10000000
+};
+
+static const uint32_t clocks[] =
+{
+    16000000, 40000000, 50000000, 80000000
+};
+
+#define RATE_COUNT  (sizeof(rates) / sizeof(rates[0]))
+#define CLOCK_COUNT (sizeof(clocks) / sizeof(clocks[0]))
+
+// Divisors from the datasheet examples and by hand
+typedef struct _BAUD_CASE
+{
+    uint32_t baudRate;
+    uint32_t fcyc;
+    uint16_t ibrd;
+    uint8_t fbrd;
+    bool highSpeed;
+    int16_t error;
+} BAUD_CASE;
+
+static const BAUD_CASE cases[] =
+{
+    {  115200, 16000000,   8, 44, false, -7 },
+    {  115200, 40000000,  21, 45, false,  0 },
+    {    9600, 50000000, 325, 33, false,  0 },
+    {  921600, 16000000,   1,  5, false, 64 },
+    { 2000000, 16000000,   1,  0, true,   0 },
+    { 2500000, 40000000,   1,  0, false,  0 },
+    { 5000000, 80000000,   1,  0, false,  0 },
+};
+
+#define CASE_COUNT (sizeof(cases) / sizeof(cases[0]))
+
+// One field and what the getters return for it
+typedef struct _FIELD_CASE
+{
+    const char *text;
+    char type;
+    int32_t integer;
+    float real;
+} FIELD_CASE;
+
+static const FIELD_CASE fields[] =
+{
+    { "0",              'n',  0,          0.0f },
+    { "+7",             'n',  7,          7.0f },
+    { "-42",            'n',  -42,        -42.0f },
+    { "1.5",            'n',  1,          1.5f },
+    { "-1.25",          'n',  -1,         -1.25f },
+    { ".5",             'n',  0,          0.5f },
+    { "0x10",           'n',  16,         16.0f },
+    { "0XfF",           'n',  255,        255.0f },
+    { "2147483647",     'n',  INT32_MAX,  2147483647.0f },
+    { "-2147483648",    'n',  INT32_MIN,  -2147483648.0f },
+    // past int32_t, the getters clamp
+    { "2147483648",     'a',  INT32_MAX,  2147483648.0f },
+    { "99999999999",    'a',  INT32_MAX,  99999999999.0f },
+    { "-2147483649",    'a',  INT32_MIN,  -2147483649.0f },
+    { "-99999999999.0", 'n',  INT32_MIN,  -99999999999.0f },
+    { "0x100000000",    'a',  0,          0.0f },
+    { "9e",             'a',  0,          0.0f },
+    { "1.2.3",          'a',  0,          0.0f },
+    { ".",              'a',  0,          0.0f },
+    { "-",              'a',  0,          0.0f },
+    { "0x",             'a',  0,          0.0f },
+    { "baud",           'a',  0,          0.0f },
+};
+
+#define FIELD_COUNT (sizeof(fields) / sizeof(fields[0]))
+
+// One character at 115200 baud, 10 bits of 16 clocks at 40 MHz / 21.703125
+#define CHAR_NS (10 * 16 * 1389 * 25 / 64)
+
+// Driver state the uDMA tests look at
+extern volatile uint32_t dmaTable[];
+extern char txFrame[2][UART0_FRAME_SIZE];
+
+static uint8_t handled;
+
+static void countCommand(USER_DATA *data)
+{
+    (void)data;
+    handled++;
+}
+
+#define COMMANDS(X) \
+    X('b', 'd', 4, "baud", 1, countCommand) \
+    X('h', 'p', 4, "help", 0, countCommand)
+
+static const COMMAND commands[COMMAND_SLOTS] = { COMMANDS(COMMAND_ENTRY) };
+COMMAND_SLOTS_UNIQUE(COMMANDS);
+
+// bold lands in the slot of baud
+#define COLLIDING(X) \
+    X('b', 'd', 4, "baud", 1, countCommand) \
+    X('b', 'd', 4, "bold", 1, countCommand)
+
+//-----------------------------------------------------------------------------
+// Subroutines
+//-----------------------------------------------------------------------------
+
+// Every rate at every clock against a divisor rounded to 1/64 in double
+static void checkBaudTable(void)
+{
+    UART0_BAUD baud;
+    uint8_t r, c, n;
+    uint32_t divisor64, actual;
+    int32_t error;
+    bool ok;
+
+    for (c = 0; c < CLOCK_COUNT; c++)
+    {
+        for (r = 0; r < RATE_COUNT; r++)
+        {
+            ok = computeUart0Baud(rates[r], clocks[c], &baud);
+            if (rates[r] > clocks[c] / 8)
+            {
+                CHECK(!ok);
+                continue;
+            }
+            n = rates[r] > clocks[c] / 16 ? 8 : 16;
+            divisor64 = floor(64.0 * clocks[c] / ((double)n * rates[r]) + 0.5);
+            if (divisor64 >> 6 > 0xFFFF)
+            {
+                CHECK(!ok);
+                continue;
+            }
+            actual = floor(64.0 * clocks[c] / ((double)n * divisor64) + 0.5);
+            error = ((int64_t)actual - rates[r]) * 10000 / rates[r];
+            CHECK(baud.highSpeed == (n == 8));
+            CHECK(baud.ibrd == divisor64 >> 6);
+            CHECK(baud.fbrd == (divisor64 & 63));
+            CHECK_NEAR(baud.baudRate, actual, 1);
+            CHECK_NEAR(baud.error, error, 1);
+            CHECK(ok == (baud.error <= UART0_BAUD_TOLERANCE && baud.error >= -UART0_BAUD_TOLERANCE));
+        }
+    }
+}
+
+static void checkBaudCases(void)
+{
+    UART0_BAUD baud;
+    uint8_t i;
+
+    for (i = 0; i < CASE_COUNT; i++)
+    {
+        CHECK(computeUart0Baud(cases[i].baudRate, cases[i].fcyc, &baud));
+        CHECK(baud.ibrd == cases[i].ibrd);
+        CHECK(baud.fbrd == cases[i].fbrd);
+        CHECK(baud.highSpeed == cases[i].highSpeed);
+        CHECK(baud.error == cases[i].error);
+    }
+}
+
+// Rates the UART cannot make
+static void checkBaudRejected(void)
+{
+    UART0_BAUD baud;
+
+    CHECK(!computeUart0Baud(0, 40000000, &baud));
+    CHECK(baud.baudRate == 0);
+    CHECK(!computeUart0Baud(2500000, 16000000, &baud));
+    CHECK(!computeUart0Baud(5000001, 40000000, &baud));
+    CHECK(computeUart0Baud(5000000, 40000000, &baud));
+    // divisor above 0xFFFF
+    CHECK(!computeUart0Baud(75, 80000000, &baud));
+    CHECK(computeUart0Baud(300, 80000000, &baud));
+}
+
+static void parse(USER_DATA *data, const char *text)
+{
+    strcpy(data->buffer, text);
+    parseFields(data);
+}
+
+static void checkFieldSplit(void)
+{
+    USER_DATA data;
+
+    parse(&data, "");
+    CHECK(data.fieldCount == 0);
+    parse(&data, " ,\t, ");
+    CHECK(data.fieldCount == 0);
+
+    // fields are terminated in place
+    parse(&data, "  set led,12\t-3 ");
+    CHECK(data.fieldCount == 4);
+    CHECK(strcmp(getFieldString(&data, 0), "set") == 0);
+    CHECK(strcmp(getFieldString(&data, 1), "led") == 0);
+    CHECK(strcmp(getFieldString(&data, 2), "12") == 0);
+    CHECK(strcmp(getFieldString(&data, 3), "-3") == 0);
+    CHECK(getFieldString(&data, 0) == &data.buffer[2]);
+    CHECK(data.fieldLength[1] == 3);
+    CHECK(data.fieldType[0] == 'a' && data.fieldType[1] == 'a');
+    CHECK(data.fieldType[2] == 'n' && data.fieldType[3] == 'n');
+    CHECK(getFieldInteger(&data, 3) == -3);
+
+    // past the last field
+    CHECK(getFieldString(&data, 4) == 0);
+    CHECK(getFieldInteger(&data, 4) == 0);
+    CHECK(getFieldFloat(&data, 4) == 0);
+
+    // the rest of a long line is left unparsed
+    parse(&data, "a b c d e f g h i j");
+    CHECK(data.fieldCount == MAX_FIELDS);
+    CHECK(strcmp(getFieldString(&data, MAX_FIELDS - 1), "h") == 0);
+}
+
+static void checkFieldValues(void)
+{
+    USER_DATA data;
+    uint8_t i;
+
+    for (i = 0; i < FIELD_COUNT; i++)
+    {
+        parse(&data, fields[i].text);
+        CHECK(data.fieldCount == 1);
+        if (data.fieldType[0] != fields[i].type || getFieldInteger(&data, 0) != fields[i].integer)
+            printf("field \"%s\": type %c, integer %d\n", fields[i].text, data.fieldType[0],
+                   getFieldInteger(&data, 0));
+        CHECK(data.fieldType[0] == fields[i].type);
+        CHECK(getFieldInteger(&data, 0) == fields[i].integer);
+        CHECK_NEAR(getFieldFloat(&data, 0), fields[i].real, fabsf(fields[i].real) * 1e-6f);
+    }
+}
+
+static void checkCommandTable(void)
+{
+    USER_DATA data;
+    COMMAND moved[COMMAND_SLOTS];
+    uint8_t slot = COMMAND_HASH('h', 'p', 4);
+
+    CHECK(checkCommands(commands));
+
+    handled = 0;
+    parse(&data, "baud 115200");
+    CHECK(dispatchCommand(&data, commands));
+    parse(&data, "help");
+    CHECK(dispatchCommand(&data, commands));
+    CHECK(handled == 2);
+
+    // too few arguments, unknown verb, same slot as baud, nothing
+    parse(&data, "baud");
+    CHECK(!dispatchCommand(&data, commands));
+    parse(&data, "bawd 1");
+    CHECK(!dispatchCommand(&data, commands));
+    parse(&data, "bold 1");
+    CHECK(!dispatchCommand(&data, commands));
+    parse(&data, " ");
+    CHECK(!dispatchCommand(&data, commands));
+    CHECK(handled == 2);
+
+    // the slot bits COMMAND_SLOTS_UNIQUE compares
+    CHECK((0 COMMANDS(COMMAND_OR)) == (0 COMMANDS(COMMAND_ADD)));
+    CHECK((0 COLLIDING(COMMAND_OR)) != (0 COLLIDING(COMMAND_ADD)));
+
+    // a verb outside of its slot, and an empty verb
+    memcpy(moved, commands, sizeof(moved));
+    moved[(slot + 1) & (COMMAND_SLOTS - 1)] = moved[slot];
+    CHECK(!checkCommands(moved));
+    memcpy(moved, commands, sizeof(moved));
+    moved[slot].verb = "";
+    CHECK(!checkCommands(moved));
+}
+
+// Wait until count characters are on the wire and check them
+static void checkWire(const char *expected, uint16_t count)
+{
+    static char wire[1024];
+
+    waitMicrosecond((count + 2) * CHAR_NS / 1000);
+    CHECK(getSimUartTx(wire, sizeof(wire)) == count);
+    CHECK(memcmp(wire, expected, count) == 0);
+}
+
+// The ring goes out through the FIFO, refilled by the TX interrupt each time
+// it drains to half, with no idle time on the line
+static void checkRingTx(void)
+{
+    char text[200];
+    SIM_UART_STATS stats;
+    uint16_t i;
+
+    for (i = 0; i < sizeof(text) - 1; i++)
+        text[i] = 'A' + i % 26;
+    text[i] = '\0';
+    simResetUart();
+    initUart0();
+    putsUart0(text);
+    checkWire(text, sizeof(text) - 1);
+
+    getSimUartStats(&stats);
+    CHECK(stats.cpuWrites == sizeof(text) - 1);
+    CHECK(stats.txOverruns == 0);
+    CHECK(stats.gapNs == 0);
+    CHECK(stats.txInterrupts <= (sizeof(text) - 1) / 8);
+    CHECK(getUart0TxCount() == 0);
+    CHECK((UART0_IM_R & UART_IM_TXIM) == 0);
+}
+
+// The descriptor startUart0Dma writes for a frame, and the channel leaving
+// it stopped with no items left
+static void checkDmaDescriptor(void)
+{
+    const volatile uint32_t *descriptor = &dmaTable[9 * 4];
+    SIM_UART_STATS stats;
+    char *frame;
+    uint16_t i;
+
+    simResetUart();
+    initUart0();
+    enableUart0Dma();
+    CHECK(UDMA_CTLBASE_R == (uint32_t)(uintptr_t)dmaTable);
+
+    frame = getUart0Frame();
+    CHECK(frame == txFrame[0]);
+    for (i = 0; i < 100; i++)
+        frame[i] = '0' + i % 10;
+    CHECK(sendUart0Frame(100));
+
+    // the pend ran uart0Isr, which enabled the channel
+    getSimUartStats(&stats);
+    CHECK(stats.dmaStarts == 1 && stats.dmaErrors == 0);
+    CHECK(stats.descriptor[0] == (uint32_t)(uintptr_t)&txFrame[0][99]);
+    CHECK(stats.descriptor[1] == (uint32_t)(uintptr_t)&UART0_DR_R);
+    CHECK(stats.descriptor[2] == (UDMA_CHCTL_DSTINC_NONE | UDMA_CHCTL_DSTSIZE_8 | UDMA_CHCTL_SRCINC_8
+                                  | UDMA_CHCTL_SRCSIZE_8 | UDMA_CHCTL_ARBSIZE_4
+                                  | (99 << UDMA_CHCTL_XFERSIZE_S) | UDMA_CHCTL_XFERMODE_BASIC));
+    checkWire(txFrame[0], 100);
+
+    getSimUartStats(&stats);
+    CHECK(stats.dmaDone == 1 && stats.dmaWrites == 100 && stats.cpuWrites == 0);
+    CHECK((descriptor[2] & (UDMA_CHCTL_XFERSIZE_M | UDMA_CHCTL_XFERMODE_M)) == UDMA_CHCTL_XFERMODE_STOP);
+    CHECK(UDMA_CHIS_R == 0);
+    CHECK((UDMA_ENASET_R & (1 << 9)) == 0);
+}
+
+// A second frame is filled while the first is sent and started by uart0Isr
+// from the completion of the first, with no gap on the line; a third waits
+// for a free frame, and ring data waits until the frames are out
+static void checkDmaHandoff(void)
+{
+    char expected[UART0_FRAME_SIZE + 100 + 5];
+    SIM_UART_STATS stats;
+    char *first, *second;
+    uint16_t i;
+
+    simResetUart();
+    first = getUart0Frame();
+    CHECK(first == txFrame[1]);
+    for (i = 0; i < UART0_FRAME_SIZE; i++)
+        first[i] = 'a' + i % 26;
+    CHECK(sendUart0Frame(UART0_FRAME_SIZE));
+
+    second = getUart0Frame();
+    CHECK(second == txFrame[0]);
+    for (i = 0; i < 100; i++)
+        second[i] = 'A' + i % 26;
+    CHECK(sendUart0Frame(100));
+    CHECK(getUart0Frame() == 0);
+    CHECK(!sendUart0Frame(1));
+    putsUart0("tail\n");
+
+    // only the first frame is on the channel
+    getSimUartStats(&stats);
+    CHECK(stats.dmaStarts == 1);
+    CHECK(stats.descriptor[0] == (uint32_t)(uintptr_t)&txFrame[1][UART0_FRAME_SIZE - 1]);
+
+    memcpy(expected, first, UART0_FRAME_SIZE);
+    memcpy(expected + UART0_FRAME_SIZE, second, 100);
+    memcpy(expected + UART0_FRAME_SIZE + 100, "tail\n", 5);
+    checkWire(expected, sizeof(expected));
+
+    getSimUartStats(&stats);
+    CHECK(stats.dmaStarts == 2 && stats.dmaDone == 2 && stats.dmaErrors == 0);
+    CHECK(stats.descriptor[0] == (uint32_t)(uintptr_t)&txFrame[0][99]);
+    CHECK(stats.dmaWrites == UART0_FRAME_SIZE + 100);
+    CHECK(stats.cpuWrites == 5);
+    CHECK(stats.txOverruns == 0);
+    CHECK(stats.gapNs == 0);
+    CHECK(getUart0Frame() == txFrame[1]);
+}
+
+// Telemetry frames are closed straight into the uDMA frames; with both busy
+// the next is dropped and counted, and the two sent decode from the wire
+static void checkTelemetry(void)
+{
+    static TELEMETRY_FRAME back;
+    static char wire[2 * TELEMETRY_ENCODED_MAX];
+    TELEMETRY_ENCODER e;
+    int16_t raw[TELEMETRY_CHANNEL_MAX] = { 0 };
+    int32_t centiC[TELEMETRY_CHANNEL_MAX] = { 0 };
+    UART0_STATS uartStats;
+    SIM_UART_STATS stats;
+    uint16_t size, first, sequence, i;
+
+    simResetUart();
+    resetUart0Stats();
+    for (sequence = 0; sequence < 3; sequence++)
+    {
+        startTelemetry(&e, sequence, 0x0003, 0x0001);
+        for (i = 0; i < 10; i++)
+        {
+            raw[0] = 4000 + i;
+            raw[1] = -i;
+            centiC[0] = 2500 + i;
+            centiC[1] = -5 * i;
+            CHECK(addTelemetryScan(&e, sequence * 100 + i * 10, false, raw, centiC));
+        }
+        CHECK(sendUart0Telemetry(&e) == (sequence < 2));
+        CHECK(e.size == 0);
+    }
+    getUart0Stats(&uartStats);
+    CHECK(uartStats.txDropped == 1);
+
+    waitMicrosecond(2 * TELEMETRY_ENCODED_MAX * CHAR_NS / 1000);
+    size = getSimUartTx(wire, sizeof(wire));
+    getSimUartStats(&stats);
+    CHECK(stats.dmaDone == 2 && stats.dmaWrites == size && stats.cpuWrites == 0);
+    CHECK(size > 0 && wire[size - 1] == 0);
+    first = (char*)memchr(wire, 0, size) - wire;
+    CHECK(decodeTelemetry((uint8_t*)wire, first, &back));
+    CHECK(back.sequence == 0 && back.count == 10);
+    CHECK(decodeTelemetry((uint8_t*)wire + first + 1, size - first - 2, &back));
+    CHECK(back.sequence == 1 && back.count == 10 && back.cjcMask == 0x0001);
+    CHECK(back.scan[9].timestampMs == 190);
+    CHECK(back.scan[9].raw[0] == 4009 && back.scan[9].raw[1] == -9);
+    CHECK(back.scan[9].centiC[0] == 2509 && back.scan[9].centiC[1] == -45);
+}
+
+// Received characters reach the line assembler through the RX and receive
+// time-out interrupts
+static void checkRx(void)
+{
+    USER_DATA data;
+
+    simUartReceive("baud 9600\r", 10);
+    waitMicrosecond((10 + 4) * CHAR_NS / 1000);     // the last 2 wait for the time-out
+    CHECK(getsUart0(&data));
+    CHECK(strcmp(data.buffer, "baud 9600") == 0);
+    CHECK(!kbhitUart0());
+}
+
+//-----------------------------------------------------------------------------
+// Main
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    (void)argc;
+    simInit();
+    simInitUart();
+    simVector(INT_UART0, uart0Isr);
+
+    checkBaudTable();
+    checkBaudCases();
+    checkBaudRejected();
+    checkFieldSplit();
+    checkFieldValues();
+    checkCommandTable();
+    checkRingTx();
+    checkDmaDescriptor();
+    checkDmaHandoff();
+    checkTelemetry();
+    checkRx();
+    return checkResult(argv[0]);
+}
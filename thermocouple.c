@@ -0,0 +1,271 @@
+// Thermocouple Library
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+//-----------------------------------------------------------------------------
+// Device includes, defines, and assembler directives
+//-----------------------------------------------------------------------------
+
+#include <stdint.h>
+#include "thermocouple.h"
+#include "typek.h"
+#include "tc_nist.h"
+
+// Breakpoint spacing of the tables in tc_nist.h
+#define TC_STEP 10
+
+//-----------------------------------------------------------------------------
+// Global variables
+//-----------------------------------------------------------------------------
+
+// Breakpoints are TC_STEP apart from tMin, except the last which is tMax
+// Reverse conversion only searches from breakpoint reverseFirst up, skipping
+// any leading part of the curve that is not monotonic (type B below 250 C)
+typedef struct _TC_TABLE
+{
+    const int32_t *uv;
+    uint16_t count;                                     // number of breakpoints
+    uint16_t reverseFirst;
+    int16_t tMin;
+    int16_t tMax;
+} TC_TABLE;
+
+typedef struct _TC_ENGINE
+{
+    float (*tempToMv)(const TC_TABLE *table, float t);
+    float (*mvToTemp)(const TC_TABLE *table, float mv);
+    int32_t (*tempToUv)(const TC_TABLE *table, int32_t centiC);
+    int32_t (*uvToTemp)(const TC_TABLE *table, int32_t uv);
+    const TC_TABLE *table;
+} TC_ENGINE;
+
+#define TC_UV(t, uv) uv,
+
+static const int32_t tcUvB[] = { TC_NIST_B(TC_UV) };
+static const int32_t tcUvE[] = { TC_NIST_E(TC_UV) };
+static const int32_t tcUvJ[] = { TC_NIST_J(TC_UV) };
+static const int32_t tcUvN[] = { TC_NIST_N(TC_UV) };
+static const int32_t tcUvR[] = { TC_NIST_R(TC_UV) };
+static const int32_t tcUvS[] = { TC_NIST_S(TC_UV) };
+static const int32_t tcUvT[] = { TC_NIST_T(TC_UV) };
+
+#define TC_COUNT(a) (sizeof(a) / sizeof(a[0]))
+
+static const TC_TABLE tcTableB = { tcUvB, TC_COUNT(tcUvB), 25, 0,    1820 };
+static const TC_TABLE tcTableE = { tcUvE, TC_COUNT(tcUvE), 0,  -270, 1000 };
+static const TC_TABLE tcTableJ = { tcUvJ, TC_COUNT(tcUvJ), 0,  -210, 1200 };
+static const TC_TABLE tcTableN = { tcUvN, TC_COUNT(tcUvN), 0,  -270, 1300 };
+static const TC_TABLE tcTableR = { tcUvR, TC_COUNT(tcUvR), 0,  -50,  1768 };
+static const TC_TABLE tcTableS = { tcUvS, TC_COUNT(tcUvS), 0,  -50,  1768 };
+static const TC_TABLE tcTableT = { tcUvT, TC_COUNT(tcUvT), 0,  -270, 400  };
+
+//-----------------------------------------------------------------------------
+// Subroutines
+//-----------------------------------------------------------------------------
+
+// Width in deg C of segment i (all TC_STEP except possibly the last)
+static int16_t tcSegmentWidth(const TC_TABLE *table, uint16_t i)
+{
+    if (i == table->count - 2)
+        return table->tMax - (table->tMin + i * TC_STEP);
+    return TC_STEP;
+}
+
+// Generic table engine
+static float tcTableTempToMv(const TC_TABLE *table, float t)
+{
+    uint16_t i;
+    float offset;
+
+    if (t < table->tMin || t > table->tMax)
+        return 0;
+
+    offset = t - table->tMin;
+    i = (uint16_t)(offset * (1.0f / TC_STEP));
+    if (i > table->count - 2)
+        i = table->count - 2;
+    offset -= i * TC_STEP;
+
+    return (table->uv[i] + (table->uv[i + 1] - table->uv[i]) * offset / tcSegmentWidth(table, i)) * 0.001f;
+}
+
+static float tcTableMvToTemp(const TC_TABLE *table, float mv)
+{
+    const int32_t *bp = table->uv + table->reverseFirst;
+    uint16_t n = table->count - 1 - table->reverseFirst;
+    uint16_t half;
+    uint16_t i;
+    float uv = mv * 1000;
+
+    // half a uV of slack so the ends survive float rounding of mv
+    if (uv < *bp - 0.5f || uv > table->uv[table->count - 1] + 0.5f)
+        return 0;
+
+    // Branch-free binary search for the last breakpoint at or below uv
+    while (n > 1)
+    {
+        half = n / 2;
+        bp = (bp[half] <= uv) ? bp + half : bp;
+        n -= half;
+    }
+
+    i = bp - table->uv;
+    return table->tMin + i * TC_STEP + (uv - bp[0]) * tcSegmentWidth(table, i) / (bp[1] - bp[0]);
+}
+
+// Integer table engine in uV and 0.01 C
+// n / d rounded to nearest, d > 0
+static int32_t tcDivRound(int32_t n, int32_t d)
+{
+    return (n >= 0 ? n + d / 2 : n - d / 2) / d;
+}
+
+static int32_t tcTableTempToUv(const TC_TABLE *table, int32_t centiC)
+{
+    uint16_t i;
+    int32_t offset;
+
+    if (centiC < table->tMin * 100 || centiC > table->tMax * 100)
+        return 0;
+
+    offset = centiC - table->tMin * 100;
+    i = offset / (TC_STEP * 100);
+    if (i > table->count - 2)
+        i = table->count - 2;
+    offset -= i * TC_STEP * 100;
+
+    return table->uv[i] + tcDivRound((table->uv[i + 1] - table->uv[i]) * offset, tcSegmentWidth(table, i) * 100);
+}
+
+static int32_t tcTableUvToTemp(const TC_TABLE *table, int32_t uv)
+{
+    const int32_t *bp = table->uv + table->reverseFirst;
+    uint16_t n = table->count - 1 - table->reverseFirst;
+    uint16_t half;
+    uint16_t i;
+
+    if (uv < *bp || uv > table->uv[table->count - 1])
+        return 0;
+
+    while (n > 1)
+    {
+        half = n / 2;
+        bp = (bp[half] <= uv) ? bp + half : bp;
+        n -= half;
+    }
+
+    i = bp - table->uv;
+    return (table->tMin + i * TC_STEP) * 100 + tcDivRound((uv - bp[0]) * tcSegmentWidth(table, i) * 100, bp[1] - bp[0]);
+}
+
+// Type K uses its own engine selected by TYPEK_ENGINE
+static float tcTypeKTempToMv(const TC_TABLE *table, float t)
+{
+    (void)table;
+    return typek_temp_to_mv(t);
+}
+
+static float tcTypeKMvToTemp(const TC_TABLE *table, float mv)
+{
+    (void)table;
+    return typek_mv_to_temp(mv);
+}
+
+static int32_t tcTypeKTempToUv(const TC_TABLE *table, int32_t centiC)
+{
+    (void)table;
+    return typek_temp_to_uv(centiC);
+}
+
+static int32_t tcTypeKUvToTemp(const TC_TABLE *table, int32_t uv)
+{
+    (void)table;
+    return typek_uv_to_temp(uv);
+}
+
+// Indexed by TC_TYPE, so a conversion is a table load and an indirect call
+static const TC_ENGINE tcEngines[TC_TYPE_COUNT] =
+{
+    { tcTableTempToMv, tcTableMvToTemp, tcTableTempToUv, tcTableUvToTemp, &tcTableB },  // TC_TYPE_B
+    { tcTableTempToMv, tcTableMvToTemp, tcTableTempToUv, tcTableUvToTemp, &tcTableE },  // TC_TYPE_E
+    { tcTableTempToMv, tcTableMvToTemp, tcTableTempToUv, tcTableUvToTemp, &tcTableJ },  // TC_TYPE_J
+    { tcTypeKTempToMv, tcTypeKMvToTemp, tcTypeKTempToUv, tcTypeKUvToTemp, 0 },          // TC_TYPE_K
+    { tcTableTempToMv, tcTableMvToTemp, tcTableTempToUv, tcTableUvToTemp, &tcTableN },  // TC_TYPE_N
+    { tcTableTempToMv, tcTableMvToTemp, tcTableTempToUv, tcTableUvToTemp, &tcTableR },  // TC_TYPE_R
+    { tcTableTempToMv, tcTableMvToTemp, tcTableTempToUv, tcTableUvToTemp, &tcTableS },  // TC_TYPE_S
+    { tcTableTempToMv, tcTableMvToTemp, tcTableTempToUv, tcTableUvToTemp, &tcTableT }   // TC_TYPE_T
+};
+
+// Convert a junction temperature (deg C) to the thermocouple voltage (mV)
+// Returns 0 outside of the range of the type
+float tc_temp_to_mv(TC_TYPE type, float t)
+{
+    const TC_ENGINE *engine;
+
+    if (type >= TC_TYPE_COUNT)
+        return 0;
+    engine = &tcEngines[type];
+    return engine->tempToMv(engine->table, t);
+}
+
+// Convert a thermocouple voltage (mV) to the junction temperature (deg C)
+// Returns 0 outside of the range of the type
+float tc_mv_to_temp(TC_TYPE type, float mv)
+{
+    const TC_ENGINE *engine;
+
+    if (type >= TC_TYPE_COUNT)
+        return 0;
+    engine = &tcEngines[type];
+    return engine->mvToTemp(engine->table, mv);
+}
+
+// Add the voltage the thermocouple would produce at the cold junction
+// temperature to the measured voltage and convert the sum to a temperature
+float tc_convert(TC_TYPE type, float mv, float cjcC)
+{
+    const TC_ENGINE *engine;
+
+    if (type >= TC_TYPE_COUNT)
+        return 0;
+    engine = &tcEngines[type];
+    return engine->mvToTemp(engine->table, mv + engine->tempToMv(engine->table, cjcC));
+}
+
+// Integer conversions, as above in uV and 0.01 C
+int32_t tc_temp_to_uv(TC_TYPE type, int32_t centiC)
+{
+    const TC_ENGINE *engine;
+
+    if (type >= TC_TYPE_COUNT)
+        return 0;
+    engine = &tcEngines[type];
+    return engine->tempToUv(engine->table, centiC);
+}
+
+int32_t tc_uv_to_temp(TC_TYPE type, int32_t uv)
+{
+    const TC_ENGINE *engine;
+
+    if (type >= TC_TYPE_COUNT)
+        return 0;
+    engine = &tcEngines[type];
+    return engine->uvToTemp(engine->table, uv);
+}
+
+// No float on the path, for the acquisition loop
+int32_t tc_convert_uv(TC_TYPE type, int32_t uv, int32_t cjcCentiC)
+{
+    const TC_ENGINE *engine;
+
+    if (type >= TC_TYPE_COUNT)
+        return 0;
+    engine = &tcEngines[type];
+    return engine->uvToTemp(engine->table, uv + engine->tempToUv(engine->table, cjcCentiC));
+}
@@ -0,0 +1,50 @@
+// Thermocouple Library
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+//-----------------------------------------------------------------------------
+// Device includes, defines, and assembler directives
+//-----------------------------------------------------------------------------
+
+#ifndef THERMOCOUPLE_H_
+#define THERMOCOUPLE_H_
+
+#include <stdint.h>
+
+typedef enum _TC_TYPE
+{
+    TC_TYPE_B,
+    TC_TYPE_E,
+    TC_TYPE_J,
+    TC_TYPE_K,
+    TC_TYPE_N,
+    TC_TYPE_R,
+    TC_TYPE_S,
+    TC_TYPE_T,
+    TC_TYPE_COUNT
+} TC_TYPE;
+
+//-----------------------------------------------------------------------------
+// Subroutines
+//-----------------------------------------------------------------------------
+
+// Hot junction temperature (deg C) from the measured voltage (mV) and the
+// cold junction temperature (deg C)
+float tc_convert(TC_TYPE type, float mv, float cjcC);
+
+// Reference table conversions for a single junction
+float tc_temp_to_mv(TC_TYPE type, float t);
+float tc_mv_to_temp(TC_TYPE type, float mv);
+
+// Integer versions in uV and 0.01 C, rounded to the nearest unit
+int32_t tc_convert_uv(TC_TYPE type, int32_t uv, int32_t cjcCentiC);
+int32_t tc_temp_to_uv(TC_TYPE type, int32_t centiC);
+int32_t tc_uv_to_temp(TC_TYPE type, int32_t uv);
+
+#endif
@@ -0,0 +1,310 @@
+// Type K Thermocouple Library
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+//-----------------------------------------------------------------------------
+// Device includes, defines, and assembler directives
+//-----------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <math.h>
+#include "typek.h"
+
+#if TYPEK_STEP != 1 && TYPEK_STEP != 5 && TYPEK_STEP != 10
+#error "TYPEK_STEP must be 1, 5 or 10"
+#endif
+
+//-----------------------------------------------------------------------------
+// Global variables
+//-----------------------------------------------------------------------------
+
+// Breakpoints in uV, selected from the 1 C NIST list at compile time
+// Slopes are taken from neighbouring breakpoints, so the forward and reverse
+// directions always agree with each other and with the reference table
+#define NIST10(t, uv) TYPEK_ENTRY(uv)
+#if TYPEK_STEP <= 5
+#define NIST5(t, uv) TYPEK_ENTRY(uv)
+#else
+#define NIST5(t, uv)
+#endif
+#if TYPEK_STEP == 1
+#define NIST1(t, uv) TYPEK_ENTRY(uv)
+#else
+#define NIST1(t, uv)
+#endif
+
+#define NIST_BEGIN(t, uv) uv,
+#define TYPEK_ENTRY(uv) uv,
+#define NIST_END(t, uv) uv
+
+const int32_t typekUv[] =
+{
+#include "typek_nist.h"
+};
+
+#undef NIST_BEGIN
+#undef TYPEK_ENTRY
+#undef NIST_END
+
+// Segment slopes in uV per 0.01 C, Q16
+// Each entry closes the element of the segment below it, the end entry closes
+// the shorter last segment
+#define NIST_BEGIN(t, uv) (int32_t)((-(uv)
+#define TYPEK_ENTRY(uv) + (uv)) * 65536.0 / (TYPEK_STEP * 100) + 0.5), (int32_t)((-(uv)
+#define NIST_END(t, uv) + (uv)) * 65536.0 / (TYPEK_LAST_WIDTH * 100) + 0.5)
+
+const int32_t typekSlope[] =
+{
+#include "typek_nist.h"
+};
+
+#undef NIST_BEGIN
+#undef TYPEK_ENTRY
+#undef NIST_END
+
+// Reciprocal slopes in 0.01 C per uV, Q16
+#define NIST_BEGIN(t, uv) (int32_t)(65536.0 * 100 / ((-(uv)
+#define TYPEK_ENTRY(uv) + (uv)) / (TYPEK_STEP * 1.0)) + 0.5), (int32_t)(65536.0 * 100 / ((-(uv)
+#define NIST_END(t, uv) + (uv)) / (TYPEK_LAST_WIDTH * 1.0)) + 0.5)
+
+const int32_t typekInverseSlope[] =
+{
+#include "typek_nist.h"
+};
+
+#undef NIST_BEGIN
+#undef TYPEK_ENTRY
+#undef NIST_END
+#undef NIST10
+#undef NIST5
+#undef NIST1
+
+// Fails to compile if the list does not produce one breakpoint per segment edge
+// and one slope per segment
+typedef char typekTableSizeCheck[(sizeof(typekUv) / sizeof(typekUv[0]) == TYPEK_SEGMENT_COUNT + 1) ? 1 : -1];
+typedef char typekSlopeSizeCheck[(sizeof(typekSlope) / sizeof(typekSlope[0]) == TYPEK_SEGMENT_COUNT) ? 1 : -1];
+typedef char typekInverseSizeCheck[(sizeof(typekInverseSlope) / sizeof(typekInverseSlope[0]) == TYPEK_SEGMENT_COUNT) ? 1 : -1];
+
+// NIST ITS-90 type K reference polynomials, coefficients in ascending order
+// E = sum(c[i] * t^i) mV, plus a0 * exp(a1 * (t - a2)^2) above 0 C
+static const float typekDirectBelow0[11] =
+{
+    0.0f,             3.9450128025e-2f, 2.3622373598e-5f, -3.2858906784e-7f,
+    -4.9904828777e-9f, -6.7509059173e-11f, -5.7410327428e-13f, -3.1088872894e-15f,
+    -1.0451609365e-17f, -1.9889266878e-20f, -1.6322697486e-23f
+};
+
+static const float typekDirectAbove0[10] =
+{
+    -1.7600413686e-2f, 3.8921204975e-2f, 1.8558770032e-5f, -9.9457592874e-8f,
+    3.1840945719e-10f, -5.6072844889e-13f, 5.6075059059e-16f, -3.2020720003e-19f,
+    9.7151147152e-23f, -1.2104721275e-26f
+};
+
+#define TYPEK_A0 1.185976e-1f
+#define TYPEK_A1 -1.183432e-4f
+#define TYPEK_A2 126.9686f
+
+// t = sum(d[i] * E^i) C over -5.891 to 0, 0 to 20.644 and 20.644 to 54.886 mV
+// NIST gives no inverse below -200 C, so voltages under -5.891 mV use the table
+static const float typekInverseBelow0[9] =
+{
+    0.0f, 2.5173462e1f, -1.1662878f, -1.0833638f,
+    -8.9773540e-1f, -3.7342377e-1f, -8.6632643e-2f, -1.0450598e-2f,
+    -5.1920577e-4f
+};
+
+static const float typekInverseTo500[10] =
+{
+    0.0f, 2.508355e1f, 7.860106e-2f, -2.503131e-1f,
+    8.315270e-2f, -1.228034e-2f, 9.804036e-4f, -4.413030e-5f,
+    1.057734e-6f, -1.052755e-8f
+};
+
+static const float typekInverseAbove500[7] =
+{
+    -1.318058e2f, 4.830222e1f, -1.646031f, 5.464731e-2f,
+    -9.650715e-4f, 8.802193e-6f, -3.110810e-8f
+};
+
+//-----------------------------------------------------------------------------
+// Subroutines
+//-----------------------------------------------------------------------------
+
+// Find the segment holding a temperature given as an offset from TYPEK_T_MIN
+// in units of 1/scale C
+static uint16_t typekSegmentFromTemp(int32_t offset, int32_t scale)
+{
+    uint16_t i = offset / (TYPEK_STEP * scale);
+    return i >= TYPEK_SEGMENT_COUNT - 1 ? TYPEK_SEGMENT_COUNT - 1 : i;
+}
+
+// Branch-free binary search for the last breakpoint at or below uv
+// log2(TYPEK_SEGMENT_COUNT) iterations, the select compiles to a conditional move
+static uint16_t typekSegmentFromUv(int32_t uv)
+{
+    const int32_t *bp = typekUv;
+    uint16_t n = TYPEK_SEGMENT_COUNT;
+    uint16_t half;
+
+    while (n > 1)
+    {
+        half = n / 2;
+        bp = (bp[half] <= uv) ? bp + half : bp;
+        n -= half;
+    }
+    return bp - typekUv;
+}
+
+// Convert a junction temperature (deg C) to the type K thermocouple voltage (mV)
+// Returns 0 outside of -270 to 1372 C
+float typek_table_temp_to_mv(float t)
+{
+    uint16_t i;
+    float offset;
+
+    if (t < TYPEK_T_MIN || t > TYPEK_T_MAX)
+        return 0;
+
+    offset = t - TYPEK_T_MIN;
+    i = typekSegmentFromTemp((int32_t)offset, 1);
+    offset -= i * TYPEK_STEP;
+    return (typekUv[i] + typekSlope[i] * offset * (100 / 65536.0f)) * 0.001f;
+}
+
+// Convert a type K thermocouple voltage (mV) to the junction temperature (deg C)
+// Returns 0 outside of -6.458 to 54.886 mV
+float typek_table_mv_to_temp(float mv)
+{
+    uint16_t i;
+    float uv = mv * 1000;
+
+    if (mv < TYPEK_MV_MIN || mv > TYPEK_MV_MAX)
+        return 0;
+
+    i = typekSegmentFromUv((int32_t)floorf(uv));
+    return TYPEK_T_MIN + i * TYPEK_STEP + (uv - typekUv[i]) * typekInverseSlope[i] * (0.01f / 65536);
+}
+
+// Convert a junction temperature (0.01 C) to the type K thermocouple voltage (uV)
+// Returns 0 outside of -270 to 1372 C
+int32_t typek_fixed_temp_to_uv(int32_t centiC)
+{
+    uint16_t i;
+    int32_t offset;
+
+    if (centiC < TYPEK_T_MIN * 100 || centiC > TYPEK_T_MAX * 100)
+        return 0;
+
+    offset = centiC - TYPEK_T_MIN * 100;
+    i = typekSegmentFromTemp(offset, 100);
+    offset -= i * TYPEK_STEP * 100;
+    return typekUv[i] + ((typekSlope[i] * offset + 0x8000) >> 16);
+}
+
+// Convert a type K thermocouple voltage (uV) to the junction temperature (0.01 C)
+// Returns 0 outside of -6458 to 54886 uV
+int32_t typek_fixed_uv_to_temp(int32_t uv)
+{
+    uint16_t i;
+
+    if (uv < TYPEK_UV_MIN || uv > TYPEK_UV_MAX)
+        return 0;
+
+    i = typekSegmentFromUv(uv);
+    return (TYPEK_T_MIN + i * TYPEK_STEP) * 100 + ((typekInverseSlope[i] * (uv - typekUv[i]) + 0x8000) >> 16);
+}
+
+// Evaluate c[0] + c[1]x + ... + c[n-1]x^(n-1) by Horner's scheme
+static float horner(const float c[], uint8_t n, float x)
+{
+    float y = c[n - 1];
+    while (--n > 0)
+        y = y * x + c[n - 1];
+    return y;
+}
+
+// Convert a junction temperature (deg C) to mV using the NIST polynomials
+// Returns 0 outside of -270 to 1372 C
+float typek_poly_temp_to_mv(float t)
+{
+    float d;
+
+    if (t < TYPEK_T_MIN || t > TYPEK_T_MAX)
+        return 0;
+
+    if (t < 0)
+        return horner(typekDirectBelow0, 11, t);
+
+    d = t - TYPEK_A2;
+    return horner(typekDirectAbove0, 10, t) + TYPEK_A0 * expf(TYPEK_A1 * d * d);
+}
+
+// Convert a thermocouple voltage (mV) to deg C using the NIST inverse polynomials
+// Returns 0 outside of -6.458 to 54.886 mV
+float typek_poly_mv_to_temp(float mv)
+{
+    if (mv < -5.891f)
+        return typek_table_mv_to_temp(mv);
+    if (mv < 0)
+        return horner(typekInverseBelow0, 9, mv);
+    if (mv < 20.644f)
+        return horner(typekInverseTo500, 10, mv);
+    if (mv <= TYPEK_MV_MAX)
+        return horner(typekInverseAbove500, 7, mv);
+    return 0;
+}
+
+// Selected conversion engine
+
+#if TYPEK_ENGINE == TYPEK_ENGINE_POLYNOMIAL
+
+float typek_temp_to_mv(float t)
+{
+    return typek_poly_temp_to_mv(t);
+}
+
+float typek_mv_to_temp(float mv)
+{
+    return typek_poly_mv_to_temp(mv);
+}
+
+int32_t typek_temp_to_uv(int32_t centiC)
+{
+    return lroundf(typek_poly_temp_to_mv(centiC * 0.01f) * 1000);
+}
+
+int32_t typek_uv_to_temp(int32_t uv)
+{
+    return lroundf(typek_poly_mv_to_temp(uv * 0.001f) * 100);
+}
+
+#else
+
+float typek_temp_to_mv(float t)
+{
+    return typek_table_temp_to_mv(t);
+}
+
+float typek_mv_to_temp(float mv)
+{
+    return typek_table_mv_to_temp(mv);
+}
+
+int32_t typek_temp_to_uv(int32_t centiC)
+{
+    return typek_fixed_temp_to_uv(centiC);
+}
+
+int32_t typek_uv_to_temp(int32_t uv)
+{
+    return typek_fixed_uv_to_temp(uv);
+}
+
+#endif
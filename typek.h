@@ -0,0 +1,74 @@
+// Type K Thermocouple Library
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+//-----------------------------------------------------------------------------
+// Device includes, defines, and assembler directives
+//-----------------------------------------------------------------------------
+
+#ifndef TYPEK_H_
+#define TYPEK_H_
+
+#include <stdint.h>
+
+// Conversion engines, choose one by defining TYPEK_ENGINE in the build options
+#define TYPEK_ENGINE_TABLE      0                       // linear segments every TYPEK_STEP C (float and integer)
+#define TYPEK_ENGINE_POLYNOMIAL 1                       // NIST ITS-90 polynomials (float)
+
+#ifndef TYPEK_ENGINE
+#define TYPEK_ENGINE TYPEK_ENGINE_TABLE
+#endif
+
+// Table breakpoint spacing in deg C (1, 5 or 10)
+// Finer tables cost flash (about 19.3 KiB at 1 C, 2 KiB at 10 C) but not time
+#ifndef TYPEK_STEP
+#define TYPEK_STEP 10
+#endif
+
+// Breakpoints are TYPEK_STEP apart, so the segment holding a temperature is
+// found directly as (t - TYPEK_T_MIN) / TYPEK_STEP instead of by searching
+// The last segment ends at 1372 C and is only TYPEK_LAST_WIDTH wide
+#define TYPEK_T_MIN         -270
+#define TYPEK_T_MAX         1372
+#define TYPEK_SEGMENT_COUNT ((TYPEK_T_MAX - TYPEK_T_MIN - 1) / TYPEK_STEP + 1)
+#define TYPEK_LAST_WIDTH    (TYPEK_T_MAX - TYPEK_T_MIN - (TYPEK_SEGMENT_COUNT - 1) * TYPEK_STEP)
+#define TYPEK_MV_MIN        -6.458f
+#define TYPEK_MV_MAX        54.886f
+#define TYPEK_UV_MIN        -6458
+#define TYPEK_UV_MAX        54886
+
+// Breakpoint voltages in uV at TYPEK_T_MIN + i * TYPEK_STEP, ending at TYPEK_T_MAX
+extern const int32_t typekUv[TYPEK_SEGMENT_COUNT + 1];
+
+// Segment slopes generated from the breakpoints at compile time, Q16 fixed
+// point, in uV per 0.01 C and 0.01 C per uV
+extern const int32_t typekSlope[TYPEK_SEGMENT_COUNT];
+extern const int32_t typekInverseSlope[TYPEK_SEGMENT_COUNT];
+
+//-----------------------------------------------------------------------------
+// Subroutines
+//-----------------------------------------------------------------------------
+
+// Selected engine
+float typek_temp_to_mv(float t);
+float typek_mv_to_temp(float mv);
+
+// Integer versions, temperatures in 0.01 C and voltages in uV
+int32_t typek_temp_to_uv(int32_t centiC);
+int32_t typek_uv_to_temp(int32_t uv);
+
+// Individual engines
+float typek_table_temp_to_mv(float t);
+float typek_table_mv_to_temp(float mv);
+int32_t typek_fixed_temp_to_uv(int32_t centiC);
+int32_t typek_fixed_uv_to_temp(int32_t uv);
+float typek_poly_temp_to_mv(float t);
+float typek_poly_mv_to_temp(float mv);
+
+#endif
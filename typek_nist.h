@@ -0,0 +1,342 @@
+// Type K Thermocouple Reference Table
+// NIST ITS-90, thermoelectric voltage in uV at every 1 C from -270 to 1372 C
+
+// This file is included inside array initializers. Before including it, define
+//   NIST_BEGIN(t, uv) the -270 C start of the range
+//   NIST10(t, uv)     entries on a 10 C boundary
+//   NIST5(t, uv)      entries on a 5 C boundary that are not on a 10 C boundary
+//   NIST1(t, uv)      all other entries
+//   NIST_END(t, uv)   the 1372 C end of the range
+// Expanding the unwanted classes to nothing selects a coarser table at compile time
+// Per-segment tables are built by letting each entry close the element opened
+// by the entry before it and open the next
+
+NIST_BEGIN(-270, -6458) NIST1(-269, -6457) NIST1(-268, -6456) NIST1(-267, -6455) NIST1(-266, -6453)
+NIST5(-265, -6452) NIST1(-264, -6450) NIST1(-263, -6448) NIST1(-262, -6446) NIST1(-261, -6444)
+NIST10(-260, -6441) NIST1(-259, -6438) NIST1(-258, -6435) NIST1(-257, -6432) NIST1(-256, -6429)
+NIST5(-255, -6425) NIST1(-254, -6421) NIST1(-253, -6417) NIST1(-252, -6413) NIST1(-251, -6408)
+NIST10(-250, -6404) NIST1(-249, -6399) NIST1(-248, -6393) NIST1(-247, -6388) NIST1(-246, -6382)
+NIST5(-245, -6377) NIST1(-244, -6370) NIST1(-243, -6364) NIST1(-242, -6358) NIST1(-241, -6351)
+NIST10(-240, -6344) NIST1(-239, -6337) NIST1(-238, -6329) NIST1(-237, -6322) NIST1(-236, -6314)
+NIST5(-235, -6306) NIST1(-234, -6297) NIST1(-233, -6289) NIST1(-232, -6280) NIST1(-231, -6271)
+NIST10(-230, -6262) NIST1(-229, -6252) NIST1(-228, -6243) NIST1(-227, -6233) NIST1(-226, -6223)
+NIST5(-225, -6213) NIST1(-224, -6202) NIST1(-223, -6192) NIST1(-222, -6181) NIST1(-221, -6170)
+NIST10(-220, -6158) NIST1(-219, -6147) NIST1(-218, -6135) NIST1(-217, -6123) NIST1(-216, -6111)
+NIST5(-215, -6099) NIST1(-214, -6087) NIST1(-213, -6074) NIST1(-212, -6061) NIST1(-211, -6048)
+NIST10(-210, -6035) NIST1(-209, -6021) NIST1(-208, -6007) NIST1(-207, -5994) NIST1(-206, -5980)
+NIST5(-205, -5965) NIST1(-204, -5951) NIST1(-203, -5936) NIST1(-202, -5922) NIST1(-201, -5907)
+NIST10(-200, -5891) NIST1(-199, -5876) NIST1(-198, -5861) NIST1(-197, -5845) NIST1(-196, -5829)
+NIST5(-195, -5813) NIST1(-194, -5797) NIST1(-193, -5780) NIST1(-192, -5763) NIST1(-191, -5747)
+NIST10(-190, -5730) NIST1(-189, -5713) NIST1(-188, -5695) NIST1(-187, -5678) NIST1(-186, -5660)
+NIST5(-185, -5642) NIST1(-184, -5624) NIST1(-183, -5606) NIST1(-182, -5588) NIST1(-181, -5569)
+NIST10(-180, -5550) NIST1(-179, -5531) NIST1(-178, -5512) NIST1(-177, -5493) NIST1(-176, -5474)
+NIST5(-175, -5454) NIST1(-174, -5435) NIST1(-173, -5415) NIST1(-172, -5395) NIST1(-171, -5374)
+NIST10(-170, -5354) NIST1(-169, -5333) NIST1(-168, -5313) NIST1(-167, -5292) NIST1(-166, -5271)
+NIST5(-165, -5250) NIST1(-164, -5228) NIST1(-163, -5207) NIST1(-162, -5185) NIST1(-161, -5163)
+NIST10(-160, -5141) NIST1(-159, -5119) NIST1(-158, -5097) NIST1(-157, -5074) NIST1(-156, -5052)
+NIST5(-155, -5029) NIST1(-154, -5006) NIST1(-153, -4983) NIST1(-152, -4960) NIST1(-151, -4936)
+NIST10(-150, -4913) NIST1(-149, -4889) NIST1(-148, -4865) NIST1(-147, -4841) NIST1(-146, -4817)
+NIST5(-145, -4793) NIST1(-144, -4768) NIST1(-143, -4744) NIST1(-142, -4719) NIST1(-141, -4694)
+NIST10(-140, -4669) NIST1(-139, -4644) NIST1(-138, -4618) NIST1(-137, -4593) NIST1(-136, -4567)
+NIST5(-135, -4542) NIST1(-134, -4516) NIST1(-133, -4490) NIST1(-132, -4463) NIST1(-131, -4437)
+NIST10(-130, -4411) NIST1(-129, -4384) NIST1(-128, -4357) NIST1(-127, -4330) NIST1(-126, -4303)
+NIST5(-125, -4276) NIST1(-124, -4249) NIST1(-123, -4221) NIST1(-122, -4194) NIST1(-121, -4166)
+NIST10(-120, -4138) NIST1(-119, -4110) NIST1(-118, -4082) NIST1(-117, -4054) NIST1(-116, -4025)
+NIST5(-115, -3997) NIST1(-114, -3968) NIST1(-113, -3939) NIST1(-112, -3911) NIST1(-111, -3882)
+NIST10(-110, -3852) NIST1(-109, -3823) NIST1(-108, -3794) NIST1(-107, -3764) NIST1(-106, -3734)
+NIST5(-105, -3705) NIST1(-104, -3675) NIST1(-103, -3645) NIST1(-102, -3614) NIST1(-101, -3584)
+NIST10(-100, -3554) NIST1(-99, -3523) NIST1(-98, -3492) NIST1(-97, -3462) NIST1(-96, -3431)
+NIST5(-95, -3400) NIST1(-94, -3368) NIST1(-93, -3337) NIST1(-92, -3306) NIST1(-91, -3274)
+NIST10(-90, -3243) NIST1(-89, -3211) NIST1(-88, -3179) NIST1(-87, -3147) NIST1(-86, -3115)
+NIST5(-85, -3083) NIST1(-84, -3050) NIST1(-83, -3018) NIST1(-82, -2986) NIST1(-81, -2953)
+NIST10(-80, -2920) NIST1(-79, -2887) NIST1(-78, -2854) NIST1(-77, -2821) NIST1(-76, -2788)
+NIST5(-75, -2755) NIST1(-74, -2721) NIST1(-73, -2688) NIST1(-72, -2654) NIST1(-71, -2620)
+NIST10(-70, -2587) NIST1(-69, -2553) NIST1(-68, -2519) NIST1(-67, -2485) NIST1(-66, -2450)
+NIST5(-65, -2416) NIST1(-64, -2382) NIST1(-63, -2347) NIST1(-62, -2312) NIST1(-61, -2278)
+NIST10(-60, -2243) NIST1(-59, -2208) NIST1(-58, -2173) NIST1(-57, -2138) NIST1(-56, -2103)
+NIST5(-55, -2067) NIST1(-54, -2032) NIST1(-53, -1996) NIST1(-52, -1961) NIST1(-51, -1925)
+NIST10(-50, -1889) NIST1(-49, -1854) NIST1(-48, -1818) NIST1(-47, -1782) NIST1(-46, -1745)
+NIST5(-45, -1709) NIST1(-44, -1673) NIST1(-43, -1637) NIST1(-42, -1600) NIST1(-41, -1564)
+NIST10(-40, -1527) NIST1(-39, -1490) NIST1(-38, -1453) NIST1(-37, -1417) NIST1(-36, -1380)
+NIST5(-35, -1343) NIST1(-34, -1305) NIST1(-33, -1268) NIST1(-32, -1231) NIST1(-31, -1194)
+NIST10(-30, -1156) NIST1(-29, -1119) NIST1(-28, -1081) NIST1(-27, -1043) NIST1(-26, -1006)
+NIST5(-25, -968) NIST1(-24, -930) NIST1(-23, -892) NIST1(-22, -854) NIST1(-21, -816)
+NIST10(-20, -778) NIST1(-19, -739) NIST1(-18, -701) NIST1(-17, -663) NIST1(-16, -624)
+NIST5(-15, -586) NIST1(-14, -547) NIST1(-13, -508) NIST1(-12, -470) NIST1(-11, -431)
+NIST10(-10, -392) NIST1(-9, -353) NIST1(-8, -314) NIST1(-7, -275) NIST1(-6, -236)
+NIST5(-5, -197) NIST1(-4, -157) NIST1(-3, -118) NIST1(-2, -79) NIST1(-1, -39)
+NIST10(0, 0) NIST1(1, 39) NIST1(2, 79) NIST1(3, 119) NIST1(4, 158)
+NIST5(5, 198) NIST1(6, 238) NIST1(7, 277) NIST1(8, 317) NIST1(9, 357)
+NIST10(10, 397) NIST1(11, 437) NIST1(12, 477) NIST1(13, 517) NIST1(14, 557)
+NIST5(15, 597) NIST1(16, 637) NIST1(17, 677) NIST1(18, 718) NIST1(19, 758)
+NIST10(20, 798) NIST1(21, 838) NIST1(22, 879) NIST1(23, 919) NIST1(24, 960)
+NIST5(25, 1000) NIST1(26, 1041) NIST1(27, 1081) NIST1(28, 1122) NIST1(29, 1163)
+NIST10(30, 1203) NIST1(31, 1244) NIST1(32, 1285) NIST1(33, 1326) NIST1(34, 1366)
+NIST5(35, 1407) NIST1(36, 1448) NIST1(37, 1489) NIST1(38, 1530) NIST1(39, 1571)
+NIST10(40, 1612) NIST1(41, 1653) NIST1(42, 1694) NIST1(43, 1735) NIST1(44, 1776)
+NIST5(45, 1817) NIST1(46, 1858) NIST1(47, 1899) NIST1(48, 1941) NIST1(49, 1982)
+NIST10(50, 2023) NIST1(51, 2064) NIST1(52, 2106) NIST1(53, 2147) NIST1(54, 2188)
+NIST5(55, 2230) NIST1(56, 2271) NIST1(57, 2312) NIST1(58, 2354) NIST1(59, 2395)
+NIST10(60, 2436) NIST1(61, 2478) NIST1(62, 2519) NIST1(63, 2561) NIST1(64, 2602)
+NIST5(65, 2644) NIST1(66, 2685) NIST1(67, 2727) NIST1(68, 2768) NIST1(69, 2810)
+NIST10(70, 2851) NIST1(71, 2893) NIST1(72, 2934) NIST1(73, 2976) NIST1(74, 3017)
+NIST5(75, 3059) NIST1(76, 3100) NIST1(77, 3142) NIST1(78, 3184) NIST1(79, 3225)
+NIST10(80, 3267) NIST1(81, 3308) NIST1(82, 3350) NIST1(83, 3391) NIST1(84, 3433)
+NIST5(85, 3474) NIST1(86, 3516) NIST1(87, 3557) NIST1(88, 3599) NIST1(89, 3640)
+NIST10(90, 3682) NIST1(91, 3723) NIST1(92, 3765) NIST1(93, 3806) NIST1(94, 3848)
+NIST5(95, 3889) NIST1(96, 3931) NIST1(97, 3972) NIST1(98, 4013) NIST1(99, 4055)
+NIST10(100, 4096) NIST1(101, 4138) NIST1(102, 4179) NIST1(103, 4220) NIST1(104, 4262)
+NIST5(105, 4303) NIST1(106, 4344) NIST1(107, 4385) NIST1(108, 4427) NIST1(109, 4468)
+NIST10(110, 4509) NIST1(111, 4550) NIST1(112, 4591) NIST1(113, 4633) NIST1(114, 4674)
+NIST5(115, 4715) NIST1(116, 4756) NIST1(117, 4797) NIST1(118, 4838) NIST1(119, 4879)
+NIST10(120, 4920) NIST1(121, 4961) NIST1(122, 5002) NIST1(123, 5043) NIST1(124, 5084)
+NIST5(125, 5124) NIST1(126, 5165) NIST1(127, 5206) NIST1(128, 5247) NIST1(129, 5288)
+NIST10(130, 5328) NIST1(131, 5369) NIST1(132, 5410) NIST1(133, 5450) NIST1(134, 5491)
+NIST5(135, 5532) NIST1(136, 5572) NIST1(137, 5613) NIST1(138, 5653) NIST1(139, 5694)
+NIST10(140, 5735) NIST1(141, 5775) NIST1(142, 5815) NIST1(143, 5856) NIST1(144, 5896)
+NIST5(145, 5937) NIST1(146, 5977) NIST1(147, 6017) NIST1(148, 6058) NIST1(149, 6098)
+NIST10(150, 6138) NIST1(151, 6179) NIST1(152, 6219) NIST1(153, 6259) NIST1(154, 6299)
+NIST5(155, 6339) NIST1(156, 6380) NIST1(157, 6420) NIST1(158, 6460) NIST1(159, 6500)
+NIST10(160, 6540) NIST1(161, 6580) NIST1(162, 6620) NIST1(163, 6660) NIST1(164, 6701)
+NIST5(165, 6741) NIST1(166, 6781) NIST1(167, 6821) NIST1(168, 6861) NIST1(169, 6901)
+NIST10(170, 6941) NIST1(171, 6981) NIST1(172, 7021) NIST1(173, 7060) NIST1(174, 7100)
+NIST5(175, 7140) NIST1(176, 7180) NIST1(177, 7220) NIST1(178, 7260) NIST1(179, 7300)
+NIST10(180, 7340) NIST1(181, 7380) NIST1(182, 7420) NIST1(183, 7460) NIST1(184, 7500)
+NIST5(185, 7540) NIST1(186, 7579) NIST1(187, 7619) NIST1(188, 7659) NIST1(189, 7699)
+NIST10(190, 7739) NIST1(191, 7779) NIST1(192, 7819) NIST1(193, 7859) NIST1(194, 7899)
+NIST5(195, 7939) NIST1(196, 7979) NIST1(197, 8019) NIST1(198, 8059) NIST1(199, 8099)
+NIST10(200, 8138) NIST1(201, 8178) NIST1(202, 8218) NIST1(203, 8258) NIST1(204, 8298)
+NIST5(205, 8338) NIST1(206, 8378) NIST1(207, 8418) NIST1(208, 8458) NIST1(209, 8499)
+NIST10(210, 8539) NIST1(211, 8579) NIST1(212, 8619) NIST1(213, 8659) NIST1(214, 8699)
+NIST5(215, 8739) NIST1(216, 8779) NIST1(217, 8819) NIST1(218, 8860) NIST1(219, 8900)
+NIST10(220, 8940) NIST1(221, 8980) NIST1(222, 9020) NIST1(223, 9061) NIST1(224, 9101)
+NIST5(225, 9141) NIST1(226, 9181) NIST1(227, 9222) NIST1(228, 9262) NIST1(229, 9302)
+NIST10(230, 9343) NIST1(231, 9383) NIST1(232, 9423) NIST1(233, 9464) NIST1(234, 9504)
+NIST5(235, 9545) NIST1(236, 9585) NIST1(237, 9626) NIST1(238, 9666) NIST1(239, 9707)
+NIST10(240, 9747) NIST1(241, 9788) NIST1(242, 9828) NIST1(243, 9869) NIST1(244, 9909)
+NIST5(245, 9950) NIST1(246, 9991) NIST1(247, 10031) NIST1(248, 10072) NIST1(249, 10113)
+NIST10(250, 10153) NIST1(251, 10194) NIST1(252, 10235) NIST1(253, 10276) NIST1(254, 10316)
+NIST5(255, 10357) NIST1(256, 10398) NIST1(257, 10439) NIST1(258, 10480) NIST1(259, 10520)
+NIST10(260, 10561) NIST1(261, 10602) NIST1(262, 10643) NIST1(263, 10684) NIST1(264, 10725)
+NIST5(265, 10766) NIST1(266, 10807) NIST1(267, 10848) NIST1(268, 10889) NIST1(269, 10930)
+NIST10(270, 10971) NIST1(271, 11012) NIST1(272, 11053) NIST1(273, 11094) NIST1(274, 11135)
+NIST5(275, 11176) NIST1(276, 11217) NIST1(277, 11259) NIST1(278, 11300) NIST1(279, 11341)
+NIST10(280, 11382) NIST1(281, 11423) NIST1(282, 11465) NIST1(283, 11506) NIST1(284, 11547)
+NIST5(285, 11588) NIST1(286, 11630) NIST1(287, 11671) NIST1(288, 11712) NIST1(289, 11753)
+NIST10(290, 11795) NIST1(291, 11836) NIST1(292, 11877) NIST1(293, 11919) NIST1(294, 11960)
+NIST5(295, 12001) NIST1(296, 12043) NIST1(297, 12084) NIST1(298, 12126) NIST1(299, 12167)
+NIST10(300, 12209) NIST1(301, 12250) NIST1(302, 12291) NIST1(303, 12333) NIST1(304, 12374)
+NIST5(305, 12416) NIST1(306, 12457) NIST1(307, 12499) NIST1(308, 12540) NIST1(309, 12582)
+NIST10(310, 12624) NIST1(311, 12665) NIST1(312, 12707) NIST1(313, 12748) NIST1(314, 12790)
+NIST5(315, 12831) NIST1(316, 12873) NIST1(317, 12915) NIST1(318, 12956) NIST1(319, 12998)
+NIST10(320, 13040) NIST1(321, 13081) NIST1(322, 13123) NIST1(323, 13165) NIST1(324, 13206)
+NIST5(325, 13248) NIST1(326, 13290) NIST1(327, 13331) NIST1(328, 13373) NIST1(329, 13415)
+NIST10(330, 13457) NIST1(331, 13498) NIST1(332, 13540) NIST1(333, 13582) NIST1(334, 13624)
+NIST5(335, 13665) NIST1(336, 13707) NIST1(337, 13749) NIST1(338, 13791) NIST1(339, 13833)
+NIST10(340, 13874) NIST1(341, 13916) NIST1(342, 13958) NIST1(343, 14000) NIST1(344, 14042)
+NIST5(345, 14084) NIST1(346, 14126) NIST1(347, 14167) NIST1(348, 14209) NIST1(349, 14251)
+NIST10(350, 14293) NIST1(351, 14335) NIST1(352, 14377) NIST1(353, 14419) NIST1(354, 14461)
+NIST5(355, 14503) NIST1(356, 14545) NIST1(357, 14587) NIST1(358, 14629) NIST1(359, 14671)
+NIST10(360, 14713) NIST1(361, 14755) NIST1(362, 14797) NIST1(363, 14839) NIST1(364, 14881)
+NIST5(365, 14923) NIST1(366, 14965) NIST1(367, 15007) NIST1(368, 15049) NIST1(369, 15091)
+NIST10(370, 15133) NIST1(371, 15175) NIST1(372, 15217) NIST1(373, 15259) NIST1(374, 15301)
+NIST5(375, 15343) NIST1(376, 15385) NIST1(377, 15427) NIST1(378, 15469) NIST1(379, 15511)
+NIST10(380, 15554) NIST1(381, 15596) NIST1(382, 15638) NIST1(383, 15680) NIST1(384, 15722)
+NIST5(385, 15764) NIST1(386, 15806) NIST1(387, 15849) NIST1(388, 15891) NIST1(389, 15933)
+NIST10(390, 15975) NIST1(391, 16017) NIST1(392, 16059) NIST1(393, 16102) NIST1(394, 16144)
+NIST5(395, 16186) NIST1(396, 16228) NIST1(397, 16270) NIST1(398, 16313) NIST1(399, 16355)
+NIST10(400, 16397) NIST1(401, 16439) NIST1(402, 16482) NIST1(403, 16524) NIST1(404, 16566)
+NIST5(405, 16608) NIST1(406, 16651) NIST1(407, 16693) NIST1(408, 16735) NIST1(409, 16778)
+NIST10(410, 16820) NIST1(411, 16862) NIST1(412, 16904) NIST1(413, 16947) NIST1(414, 16989)
+NIST5(415, 17031) NIST1(416, 17074) NIST1(417, 17116) NIST1(418, 17158) NIST1(419, 17201)
+NIST10(420, 17243) NIST1(421, 17285) NIST1(422, 17328) NIST1(423, 17370) NIST1(424, 17413)
+NIST5(425, 17455) NIST1(426, 17497) NIST1(427, 17540) NIST1(428, 17582) NIST1(429, 17624)
+NIST10(430, 17667) NIST1(431, 17709) NIST1(432, 17752) NIST1(433, 17794) NIST1(434, 17837)
+NIST5(435, 17879) NIST1(436, 17921) NIST1(437, 17964) NIST1(438, 18006) NIST1(439, 18049)
+NIST10(440, 18091) NIST1(441, 18134) NIST1(442, 18176) NIST1(443, 18218) NIST1(444, 18261)
+NIST5(445, 18303) NIST1(446, 18346) NIST1(447, 18388) NIST1(448, 18431) NIST1(449, 18473)
+NIST10(450, 18516) NIST1(451, 18558) NIST1(452, 18601) NIST1(453, 18643) NIST1(454, 18686)
+NIST5(455, 18728) NIST1(456, 18771) NIST1(457, 18813) NIST1(458, 18856) NIST1(459, 18898)
+NIST10(460, 18941) NIST1(461, 18983) NIST1(462, 19026) NIST1(463, 19068) NIST1(464, 19111)
+NIST5(465, 19154) NIST1(466, 19196) NIST1(467, 19239) NIST1(468, 19281) NIST1(469, 19324)
+NIST10(470, 19366) NIST1(471, 19409) NIST1(472, 19451) NIST1(473, 19494) NIST1(474, 19537)
+NIST5(475, 19579) NIST1(476, 19622) NIST1(477, 19664) NIST1(478, 19707) NIST1(479, 19750)
+NIST10(480, 19792) NIST1(481, 19835) NIST1(482, 19877) NIST1(483, 19920) NIST1(484, 19962)
+NIST5(485, 20005) NIST1(486, 20048) NIST1(487, 20090) NIST1(488, 20133) NIST1(489, 20175)
+NIST10(490, 20218) NIST1(491, 20261) NIST1(492, 20303) NIST1(493, 20346) NIST1(494, 20389)
+NIST5(495, 20431) NIST1(496, 20474) NIST1(497, 20516) NIST1(498, 20559) NIST1(499, 20602)
+NIST10(500, 20644) NIST1(501, 20687) NIST1(502, 20730) NIST1(503, 20772) NIST1(504, 20815)
+NIST5(505, 20857) NIST1(506, 20900) NIST1(507, 20943) NIST1(508, 20985) NIST1(509, 21028)
+NIST10(510, 21071) NIST1(511, 21113) NIST1(512, 21156) NIST1(513, 21199) NIST1(514, 21241)
+NIST5(515, 21284) NIST1(516, 21326) NIST1(517, 21369) NIST1(518, 21412) NIST1(519, 21454)
+NIST10(520, 21497) NIST1(521, 21540) NIST1(522, 21582) NIST1(523, 21625) NIST1(524, 21668)
+NIST5(525, 21710) NIST1(526, 21753) NIST1(527, 21796) NIST1(528, 21838) NIST1(529, 21881)
+NIST10(530, 21924) NIST1(531, 21966) NIST1(532, 22009) NIST1(533, 22052) NIST1(534, 22094)
+NIST5(535, 22137) NIST1(536, 22179) NIST1(537, 22222) NIST1(538, 22265) NIST1(539, 22307)
+NIST10(540, 22350) NIST1(541, 22393) NIST1(542, 22435) NIST1(543, 22478) NIST1(544, 22521)
+NIST5(545, 22563) NIST1(546, 22606) NIST1(547, 22649) NIST1(548, 22691) NIST1(549, 22734)
+NIST10(550, 22776) NIST1(551, 22819) NIST1(552, 22862) NIST1(553, 22904) NIST1(554, 22947)
+NIST5(555, 22990) NIST1(556, 23032) NIST1(557, 23075) NIST1(558, 23117) NIST1(559, 23160)
+NIST10(560, 23203) NIST1(561, 23245) NIST1(562, 23288) NIST1(563, 23331) NIST1(564, 23373)
+NIST5(565, 23416) NIST1(566, 23458) NIST1(567, 23501) NIST1(568, 23544) NIST1(569, 23586)
+NIST10(570, 23629) NIST1(571, 23671) NIST1(572, 23714) NIST1(573, 23757) NIST1(574, 23799)
+NIST5(575, 23842) NIST1(576, 23884) NIST1(577, 23927) NIST1(578, 23970) NIST1(579, 24012)
+NIST10(580, 24055) NIST1(581, 24097) NIST1(582, 24140) NIST1(583, 24182) NIST1(584, 24225)
+NIST5(585, 24267) NIST1(586, 24310) NIST1(587, 24353) NIST1(588, 24395) NIST1(589, 24438)
+NIST10(590, 24480) NIST1(591, 24523) NIST1(592, 24565) NIST1(593, 24608) NIST1(594, 24650)
+NIST5(595, 24693) NIST1(596, 24735) NIST1(597, 24778) NIST1(598, 24820) NIST1(599, 24863)
+NIST10(600, 24905) NIST1(601, 24948) NIST1(602, 24990) NIST1(603, 25033) NIST1(604, 25075)
+NIST5(605, 25118) NIST1(606, 25160) NIST1(607, 25203) NIST1(608, 25245) NIST1(609, 25288)
+NIST10(610, 25330) NIST1(611, 25373) NIST1(612, 25415) NIST1(613, 25458) NIST1(614, 25500)
+NIST5(615, 25543) NIST1(616, 25585) NIST1(617, 25627) NIST1(618, 25670) NIST1(619, 25712)
+NIST10(620, 25755) NIST1(621, 25797) NIST1(622, 25840) NIST1(623, 25882) NIST1(624, 25924)
+NIST5(625, 25967) NIST1(626, 26009) NIST1(627, 26052) NIST1(628, 26094) NIST1(629, 26136)
+NIST10(630, 26179) NIST1(631, 26221) NIST1(632, 26263) NIST1(633, 26306) NIST1(634, 26348)
+NIST5(635, 26390) NIST1(636, 26433) NIST1(637, 26475) NIST1(638, 26517) NIST1(639, 26560)
+NIST10(640, 26602) NIST1(641, 26644) NIST1(642, 26687) NIST1(643, 26729) NIST1(644, 26771)
+NIST5(645, 26814) NIST1(646, 26856) NIST1(647, 26898) NIST1(648, 26940) NIST1(649, 26983)
+NIST10(650, 27025) NIST1(651, 27067) NIST1(652, 27109) NIST1(653, 27152) NIST1(654, 27194)
+NIST5(655, 27236) NIST1(656, 27278) NIST1(657, 27320) NIST1(658, 27363) NIST1(659, 27405)
+NIST10(660, 27447) NIST1(661, 27489) NIST1(662, 27531) NIST1(663, 27574) NIST1(664, 27616)
+NIST5(665, 27658) NIST1(666, 27700) NIST1(667, 27742) NIST1(668, 27784) NIST1(669, 27826)
+NIST10(670, 27869) NIST1(671, 27911) NIST1(672, 27953) NIST1(673, 27995) NIST1(674, 28037)
+NIST5(675, 28079) NIST1(676, 28121) NIST1(677, 28163) NIST1(678, 28205) NIST1(679, 28247)
+NIST10(680, 28289) NIST1(681, 28332) NIST1(682, 28374) NIST1(683, 28416) NIST1(684, 28458)
+NIST5(685, 28500) NIST1(686, 28542) NIST1(687, 28584) NIST1(688, 28626) NIST1(689, 28668)
+NIST10(690, 28710) NIST1(691, 28752) NIST1(692, 28794) NIST1(693, 28835) NIST1(694, 28877)
+NIST5(695, 28919) NIST1(696, 28961) NIST1(697, 29003) NIST1(698, 29045) NIST1(699, 29087)
+NIST10(700, 29129) NIST1(701, 29171) NIST1(702, 29213) NIST1(703, 29255) NIST1(704, 29297)
+NIST5(705, 29338) NIST1(706, 29380) NIST1(707, 29422) NIST1(708, 29464) NIST1(709, 29506)
+NIST10(710, 29548) NIST1(711, 29589) NIST1(712, 29631) NIST1(713, 29673) NIST1(714, 29715)
+NIST5(715, 29757) NIST1(716, 29798) NIST1(717, 29840) NIST1(718, 29882) NIST1(719, 29924)
+NIST10(720, 29965) NIST1(721, 30007) NIST1(722, 30049) NIST1(723, 30090) NIST1(724, 30132)
+NIST5(725, 30174) NIST1(726, 30216) NIST1(727, 30257) NIST1(728, 30299) NIST1(729, 30341)
+NIST10(730, 30382) NIST1(731, 30424) NIST1(732, 30466) NIST1(733, 30507) NIST1(734, 30549)
+NIST5(735, 30590) NIST1(736, 30632) NIST1(737, 30674) NIST1(738, 30715) NIST1(739, 30757)
+NIST10(740, 30798) NIST1(741, 30840) NIST1(742, 30881) NIST1(743, 30923) NIST1(744, 30964)
+NIST5(745, 31006) NIST1(746, 31047) NIST1(747, 31089) NIST1(748, 31130) NIST1(749, 31172)
+NIST10(750, 31213) NIST1(751, 31255) NIST1(752, 31296) NIST1(753, 31338) NIST1(754, 31379)
+NIST5(755, 31421) NIST1(756, 31462) NIST1(757, 31504) NIST1(758, 31545) NIST1(759, 31586)
+NIST10(760, 31628) NIST1(761, 31669) NIST1(762, 31710) NIST1(763, 31752) NIST1(764, 31793)
+NIST5(765, 31834) NIST1(766, 31876) NIST1(767, 31917) NIST1(768, 31958) NIST1(769, 32000)
+NIST10(770, 32041) NIST1(771, 32082) NIST1(772, 32124) NIST1(773, 32165) NIST1(774, 32206)
+NIST5(775, 32247) NIST1(776, 32289) NIST1(777, 32330) NIST1(778, 32371) NIST1(779, 32412)
+NIST10(780, 32453) NIST1(781, 32495) NIST1(782, 32536) NIST1(783, 32577) NIST1(784, 32618)
+NIST5(785, 32659) NIST1(786, 32700) NIST1(787, 32742) NIST1(788, 32783) NIST1(789, 32824)
+NIST10(790, 32865) NIST1(791, 32906) NIST1(792, 32947) NIST1(793, 32988) NIST1(794, 33029)
+NIST5(795, 33070) NIST1(796, 33111) NIST1(797, 33152) NIST1(798, 33193) NIST1(799, 33234)
+NIST10(800, 33275) NIST1(801, 33316) NIST1(802, 33357) NIST1(803, 33398) NIST1(804, 33439)
+NIST5(805, 33480) NIST1(806, 33521) NIST1(807, 33562) NIST1(808, 33603) NIST1(809, 33644)
+NIST10(810, 33685) NIST1(811, 33726) NIST1(812, 33767) NIST1(813, 33808) NIST1(814, 33848)
+NIST5(815, 33889) NIST1(816, 33930) NIST1(817, 33971) NIST1(818, 34012) NIST1(819, 34053)
+NIST10(820, 34093) NIST1(821, 34134) NIST1(822, 34175) NIST1(823, 34216) NIST1(824, 34257)
+NIST5(825, 34297) NIST1(826, 34338) NIST1(827, 34379) NIST1(828, 34420) NIST1(829, 34460)
+NIST10(830, 34501) NIST1(831, 34542) NIST1(832, 34582) NIST1(833, 34623) NIST1(834, 34664)
+NIST5(835, 34704) NIST1(836, 34745) NIST1(837, 34786) NIST1(838, 34826) NIST1(839, 34867)
+NIST10(840, 34908) NIST1(841, 34948) NIST1(842, 34989) NIST1(843, 35029) NIST1(844, 35070)
+NIST5(845, 35110) NIST1(846, 35151) NIST1(847, 35192) NIST1(848, 35232) NIST1(849, 35273)
+NIST10(850, 35313) NIST1(851, 35354) NIST1(852, 35394) NIST1(853, 35435) NIST1(854, 35475)
+NIST5(855, 35516) NIST1(856, 35556) NIST1(857, 35596) NIST1(858, 35637) NIST1(859, 35677)
+NIST10(860, 35718) NIST1(861, 35758) NIST1(862, 35798) NIST1(863, 35839) NIST1(864, 35879)
+NIST5(865, 35920) NIST1(866, 35960) NIST1(867, 36000) NIST1(868, 36041) NIST1(869, 36081)
+NIST10(870, 36121) NIST1(871, 36162) NIST1(872, 36202) NIST1(873, 36242) NIST1(874, 36282)
+NIST5(875, 36323) NIST1(876, 36363) NIST1(877, 36403) NIST1(878, 36443) NIST1(879, 36484)
+NIST10(880, 36524) NIST1(881, 36564) NIST1(882, 36604) NIST1(883, 36644) NIST1(884, 36685)
+NIST5(885, 36725) NIST1(886, 36765) NIST1(887, 36805) NIST1(888, 36845) NIST1(889, 36885)
+NIST10(890, 36925) NIST1(891, 36965) NIST1(892, 37006) NIST1(893, 37046) NIST1(894, 37086)
+NIST5(895, 37126) NIST1(896, 37166) NIST1(897, 37206) NIST1(898, 37246) NIST1(899, 37286)
+NIST10(900, 37326) NIST1(901, 37366) NIST1(902, 37406) NIST1(903, 37446) NIST1(904, 37486)
+NIST5(905, 37526) NIST1(906, 37566) NIST1(907, 37606) NIST1(908, 37646) NIST1(909, 37686)
+NIST10(910, 37725) NIST1(911, 37765) NIST1(912, 37805) NIST1(913, 37845) NIST1(914, 37885)
+NIST5(915, 37925) NIST1(916, 37965) NIST1(917, 38005) NIST1(918, 38044) NIST1(919, 38084)
+NIST10(920, 38124) NIST1(921, 38164) NIST1(922, 38204) NIST1(923, 38243) NIST1(924, 38283)
+NIST5(925, 38323) NIST1(926, 38363) NIST1(927, 38402) NIST1(928, 38442) NIST1(929, 38482)
+NIST10(930, 38522) NIST1(931, 38561) NIST1(932, 38601) NIST1(933, 38641) NIST1(934, 38680)
+NIST5(935, 38720) NIST1(936, 38760) NIST1(937, 38799) NIST1(938, 38839) NIST1(939, 38878)
+NIST10(940, 38918) NIST1(941, 38958) NIST1(942, 38997) NIST1(943, 39037) NIST1(944, 39076)
+NIST5(945, 39116) NIST1(946, 39155) NIST1(947, 39195) NIST1(948, 39235) NIST1(949, 39274)
+NIST10(950, 39314) NIST1(951, 39353) NIST1(952, 39393) NIST1(953, 39432) NIST1(954, 39471)
+NIST5(955, 39511) NIST1(956, 39550) NIST1(957, 39590) NIST1(958, 39629) NIST1(959, 39669)
+NIST10(960, 39708) NIST1(961, 39747) NIST1(962, 39787) NIST1(963, 39826) NIST1(964, 39866)
+NIST5(965, 39905) NIST1(966, 39944) NIST1(967, 39984) NIST1(968, 40023) NIST1(969, 40062)
+NIST10(970, 40101) NIST1(971, 40141) NIST1(972, 40180) NIST1(973, 40219) NIST1(974, 40259)
+NIST5(975, 40298) NIST1(976, 40337) NIST1(977, 40376) NIST1(978, 40415) NIST1(979, 40455)
+NIST10(980, 40494) NIST1(981, 40533) NIST1(982, 40572) NIST1(983, 40611) NIST1(984, 40651)
+NIST5(985, 40690) NIST1(986, 40729) NIST1(987, 40768) NIST1(988, 40807) NIST1(989, 40846)
+NIST10(990, 40885) NIST1(991, 40924) NIST1(992, 40963) NIST1(993, 41002) NIST1(994, 41042)
+NIST5(995, 41081) NIST1(996, 41120) NIST1(997, 41159) NIST1(998, 41198) NIST1(999, 41237)
+NIST10(1000, 41276) NIST1(1001, 41315) NIST1(1002, 41354) NIST1(1003, 41393) NIST1(1004, 41431)
+NIST5(1005, 41470) NIST1(1006, 41509) NIST1(1007, 41548) NIST1(1008, 41587) NIST1(1009, 41626)
+NIST10(1010, 41665) NIST1(1011, 41704) NIST1(1012, 41743) NIST1(1013, 41781) NIST1(1014, 41820)
+NIST5(1015, 41859) NIST1(1016, 41898) NIST1(1017, 41937) NIST1(1018, 41976) NIST1(1019, 42014)
+NIST10(1020, 42053) NIST1(1021, 42092) NIST1(1022, 42131) NIST1(1023, 42169) NIST1(1024, 42208)
+NIST5(1025, 42247) NIST1(1026, 42286) NIST1(1027, 42324) NIST1(1028, 42363) NIST1(1029, 42402)
+NIST10(1030, 42440) NIST1(1031, 42479) NIST1(1032, 42518) NIST1(1033, 42556) NIST1(1034, 42595)
+NIST5(1035, 42633) NIST1(1036, 42672) NIST1(1037, 42711) NIST1(1038, 42749) NIST1(1039, 42788)
+NIST10(1040, 42826) NIST1(1041, 42865) NIST1(1042, 42903) NIST1(1043, 42942) NIST1(1044, 42980)
+NIST5(1045, 43019) NIST1(1046, 43057) NIST1(1047, 43096) NIST1(1048, 43134) NIST1(1049, 43173)
+NIST10(1050, 43211) NIST1(1051, 43250) NIST1(1052, 43288) NIST1(1053, 43327) NIST1(1054, 43365)
+NIST5(1055, 43403) NIST1(1056, 43442) NIST1(1057, 43480) NIST1(1058, 43518) NIST1(1059, 43557)
+NIST10(1060, 43595) NIST1(1061, 43633) NIST1(1062, 43672) NIST1(1063, 43710) NIST1(1064, 43748)
+NIST5(1065, 43787) NIST1(1066, 43825) NIST1(1067, 43863) NIST1(1068, 43901) NIST1(1069, 43940)
+NIST10(1070, 43978) NIST1(1071, 44016) NIST1(1072, 44054) NIST1(1073, 44092) NIST1(1074, 44130)
+NIST5(1075, 44169) NIST1(1076, 44207) NIST1(1077, 44245) NIST1(1078, 44283) NIST1(1079, 44321)
+NIST10(1080, 44359) NIST1(1081, 44397) NIST1(1082, 44435) NIST1(1083, 44473) NIST1(1084, 44512)
+NIST5(1085, 44550) NIST1(1086, 44588) NIST1(1087, 44626) NIST1(1088, 44664) NIST1(1089, 44702)
+NIST10(1090, 44740) NIST1(1091, 44778) NIST1(1092, 44816) NIST1(1093, 44853) NIST1(1094, 44891)
+NIST5(1095, 44929) NIST1(1096, 44967) NIST1(1097, 45005) NIST1(1098, 45043) NIST1(1099, 45081)
+NIST10(1100, 45119) NIST1(1101, 45157) NIST1(1102, 45194) NIST1(1103, 45232) NIST1(1104, 45270)
+NIST5(1105, 45308) NIST1(1106, 45346) NIST1(1107, 45383) NIST1(1108, 45421) NIST1(1109, 45459)
+NIST10(1110, 45497) NIST1(1111, 45534) NIST1(1112, 45572) NIST1(1113, 45610) NIST1(1114, 45647)
+NIST5(1115, 45685) NIST1(1116, 45723) NIST1(1117, 45760) NIST1(1118, 45798) NIST1(1119, 45836)
+NIST10(1120, 45873) NIST1(1121, 45911) NIST1(1122, 45948) NIST1(1123, 45986) NIST1(1124, 46024)
+NIST5(1125, 46061) NIST1(1126, 46099) NIST1(1127, 46136) NIST1(1128, 46174) NIST1(1129, 46211)
+NIST10(1130, 46249) NIST1(1131, 46286) NIST1(1132, 46324) NIST1(1133, 46361) NIST1(1134, 46398)
+NIST5(1135, 46436) NIST1(1136, 46473) NIST1(1137, 46511) NIST1(1138, 46548) NIST1(1139, 46585)
+NIST10(1140, 46623) NIST1(1141, 46660) NIST1(1142, 46697) NIST1(1143, 46735) NIST1(1144, 46772)
+NIST5(1145, 46809) NIST1(1146, 46847) NIST1(1147, 46884) NIST1(1148, 46921) NIST1(1149, 46958)
+NIST10(1150, 46995) NIST1(1151, 47033) NIST1(1152, 47070) NIST1(1153, 47107) NIST1(1154, 47144)
+NIST5(1155, 47181) NIST1(1156, 47218) NIST1(1157, 47256) NIST1(1158, 47293) NIST1(1159, 47330)
+NIST10(1160, 47367) NIST1(1161, 47404) NIST1(1162, 47441) NIST1(1163, 47478) NIST1(1164, 47515)
+NIST5(1165, 47552) NIST1(1166, 47589) NIST1(1167, 47626) NIST1(1168, 47663) NIST1(1169, 47700)
+NIST10(1170, 47737) NIST1(1171, 47774) NIST1(1172, 47811) NIST1(1173, 47848) NIST1(1174, 47884)
+NIST5(1175, 47921) NIST1(1176, 47958) NIST1(1177, 47995) NIST1(1178, 48032) NIST1(1179, 48069)
+NIST10(1180, 48105) NIST1(1181, 48142) NIST1(1182, 48179) NIST1(1183, 48216) NIST1(1184, 48252)
+NIST5(1185, 48289) NIST1(1186, 48326) NIST1(1187, 48363) NIST1(1188, 48399) NIST1(1189, 48436)
+NIST10(1190, 48473) NIST1(1191, 48509) NIST1(1192, 48546) NIST1(1193, 48582) NIST1(1194, 48619)
+NIST5(1195, 48656) NIST1(1196, 48692) NIST1(1197, 48729) NIST1(1198, 48765) NIST1(1199, 48802)
+NIST10(1200, 48838) NIST1(1201, 48875) NIST1(1202, 48911) NIST1(1203, 48948) NIST1(1204, 48984)
+NIST5(1205, 49021) NIST1(1206, 49057) NIST1(1207, 49093) NIST1(1208, 49130) NIST1(1209, 49166)
+NIST10(1210, 49202) NIST1(1211, 49239) NIST1(1212, 49275) NIST1(1213, 49311) NIST1(1214, 49348)
+NIST5(1215, 49384) NIST1(1216, 49420) NIST1(1217, 49456) NIST1(1218, 49493) NIST1(1219, 49529)
+NIST10(1220, 49565) NIST1(1221, 49601) NIST1(1222, 49637) NIST1(1223, 49674) NIST1(1224, 49710)
+NIST5(1225, 49746) NIST1(1226, 49782) NIST1(1227, 49818) NIST1(1228, 49854) NIST1(1229, 49890)
+NIST10(1230, 49926) NIST1(1231, 49962) NIST1(1232, 49998) NIST1(1233, 50034) NIST1(1234, 50070)
+NIST5(1235, 50106) NIST1(1236, 50142) NIST1(1237, 50178) NIST1(1238, 50214) NIST1(1239, 50250)
+NIST10(1240, 50286) NIST1(1241, 50322) NIST1(1242, 50358) NIST1(1243, 50393) NIST1(1244, 50429)
+NIST5(1245, 50465) NIST1(1246, 50501) NIST1(1247, 50537) NIST1(1248, 50572) NIST1(1249, 50608)
+NIST10(1250, 50644) NIST1(1251, 50680) NIST1(1252, 50715) NIST1(1253, 50751) NIST1(1254, 50787)
+NIST5(1255, 50822) NIST1(1256, 50858) NIST1(1257, 50894) NIST1(1258, 50929) NIST1(1259, 50965)
+NIST10(1260, 51000) NIST1(1261, 51036) NIST1(1262, 51071) NIST1(1263, 51107) NIST1(1264, 51142)
+NIST5(1265, 51178) NIST1(1266, 51213) NIST1(1267, 51249) NIST1(1268, 51284) NIST1(1269, 51320)
+NIST10(1270, 51355) NIST1(1271, 51391) NIST1(1272, 51426) NIST1(1273, 51461) NIST1(1274, 51497)
+NIST5(1275, 51532) NIST1(1276, 51567) NIST1(1277, 51603) NIST1(1278, 51638) NIST1(1279, 51673)
+NIST10(1280, 51708) NIST1(1281, 51744) NIST1(1282, 51779) NIST1(1283, 51814) NIST1(1284, 51849)
+NIST5(1285, 51885) NIST1(1286, 51920) NIST1(1287, 51955) NIST1(1288, 51990) NIST1(1289, 52025)
+NIST10(1290, 52060) NIST1(1291, 52095) NIST1(1292, 52130) NIST1(1293, 52165) NIST1(1294, 52200)
+NIST5(1295, 52235) NIST1(1296, 52270) NIST1(1297, 52305) NIST1(1298, 52340) NIST1(1299, 52375)
+NIST10(1300, 52410) NIST1(1301, 52445) NIST1(1302, 52480) NIST1(1303, 52515) NIST1(1304, 52550)
+NIST5(1305, 52585) NIST1(1306, 52620) NIST1(1307, 52654) NIST1(1308, 52689) NIST1(1309, 52724)
+NIST10(1310, 52759) NIST1(1311, 52794) NIST1(1312, 52828) NIST1(1313, 52863) NIST1(1314, 52898)
+NIST5(1315, 52932) NIST1(1316, 52967) NIST1(1317, 53002) NIST1(1318, 53037) NIST1(1319, 53071)
+NIST10(1320, 53106) NIST1(1321, 53140) NIST1(1322, 53175) NIST1(1323, 53210) NIST1(1324, 53244)
+NIST5(1325, 53279) NIST1(1326, 53313) NIST1(1327, 53348) NIST1(1328, 53382) NIST1(1329, 53417)
+NIST10(1330, 53451) NIST1(1331, 53486) NIST1(1332, 53520) NIST1(1333, 53555) NIST1(1334, 53589)
+NIST5(1335, 53623) NIST1(1336, 53658) NIST1(1337, 53692) NIST1(1338, 53727) NIST1(1339, 53761)
+NIST10(1340, 53795) NIST1(1341, 53830) NIST1(1342, 53864) NIST1(1343, 53898) NIST1(1344, 53932)
+NIST5(1345, 53967) NIST1(1346, 54001) NIST1(1347, 54035) NIST1(1348, 54069) NIST1(1349, 54104)
+NIST10(1350, 54138) NIST1(1351, 54172) NIST1(1352, 54206) NIST1(1353, 54240) NIST1(1354, 54274)
+NIST5(1355, 54308) NIST1(1356, 54343) NIST1(1357, 54377) NIST1(1358, 54411) NIST1(1359, 54445)
+NIST10(1360, 54479) NIST1(1361, 54513) NIST1(1362, 54547) NIST1(1363, 54581) NIST1(1364, 54615)
+NIST5(1365, 54649) NIST1(1366, 54683) NIST1(1367, 54717) NIST1(1368, 54751) NIST1(1369, 54785)
+NIST10(1370, 54819) NIST1(1371, 54852) NIST_END(1372, 54886)
@@ -36,3 +36,22 @@ void waitMicrosecond(uint32_t us)
     __asm("WMS_DONE0:");                        // ---
                                                 // 40 clocks/us + error
 }
+
+// Interrupt mask and sleep, for waits on a flag set by an interrupt
+// Check the flag with interrupts disabled and sleep before enabling them:
+// WFI still wakes on an interrupt that pends while they are disabled, and
+// it is taken at enableInterrupts, so none is lost between check and sleep
+void disableInterrupts(void)
+{
+    __asm("             CPSID I");
+}
+
+void enableInterrupts(void)
+{
+    __asm("             CPSIE I");
+}
+
+void waitForInterrupt(void)
+{
+    __asm("             WFI");
+}
@@ -16,5 +16,8 @@
 //-----------------------------------------------------------------------------
 
 void waitMicrosecond(uint32_t us);
+void disableInterrupts(void);
+void enableInterrupts(void);
+void waitForInterrupt(void);
 
 #endif